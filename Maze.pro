@@ -12,13 +12,73 @@ SOURCES += \
     main.cc \
     ./view/s21_view.cc \
     ./model/s21_model.cc \
+    ./model/s21_fixed_maze.cc \
+    ./model/s21_cave.cc \
+    ./model/s21_validator.cc \
+    ./model/s21_maze_io.cc \
+    ./model/s21_maze_archive.cc \
+    ./model/s21_distance_field.cc \
+    ./model/s21_thread_pool.cc \
+    ./model/s21_batch_solver.cc \
+    ./model/s21_maze_stats.cc \
+    ./model/s21_compact_path.cc \
+    ./model/s21_path_index.cc \
+    ./model/s21_tiled_maze.cc \
+    ./model/s21_tiled_solver.cc \
+    ./model/s21_generator.cc \
+    ./model/s21_rasterizer.cc \
+    ./model/s21_memory.cc \
+    ./model/s21_chunk_world.cc \
+    ./model/s21_step_solver.cc \
+    ./model/s21_maze_server.cc \
+    ./model/s21_weighted_solver.cc \
+    ./model/s21_maze_hash.cc \
+    ./model/s21_solve_cache.cc \
+    ./model/s21_trace.cc \
     ./controller/s21_controller.cc
 
 HEADERS += \
     ./view/s21_view.h \
     ./model/s21_model.h \
+    ./model/s21_fixed_maze.h \
+    ./model/s21_cave.h \
+    ./model/s21_validator.h \
+    ./model/s21_maze_io.h \
+    ./model/s21_maze_archive.h \
+    ./model/s21_distance_field.h \
+    ./model/s21_point.h \
+    ./model/s21_thread_pool.h \
+    ./model/s21_batch_solver.h \
+    ./model/s21_maze_stats.h \
+    ./model/s21_compact_path.h \
+    ./model/s21_path_index.h \
+    ./model/s21_tiled_maze.h \
+    ./model/s21_tiled_solver.h \
+    ./model/s21_generator.h \
+    ./model/s21_rasterizer.h \
+    ./model/s21_memory.h \
+    ./model/s21_chunk_world.h \
+    ./model/s21_step_solver.h \
+    ./model/s21_maze_server.h \
+    ./model/s21_weighted_solver.h \
+    ./model/s21_maze_hash.h \
+    ./model/s21_solve_cache.h \
+    ./model/s21_trace.h \
     ./controller/s21_controller.h
 
+LIBS += -lz
+
+# Поддержка файлов .zst: qmake CONFIG+=zstd
+zstd {
+    DEFINES += S21_WITH_ZSTD
+    LIBS += -lzstd
+}
+
+# Трассировка в формате Chrome trace: qmake CONFIG+=trace
+trace {
+    DEFINES += S21_WITH_TRACE
+}
+
 FORMS += \
     ./view/view.ui
 
@@ -0,0 +1,305 @@
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "../controller/s21_controller.h"
+#include "../model/s21_maze_server.h"
+#include "../model/s21_trace.h"
+
+namespace {
+
+void PrintUsage() {
+  std::cerr << "Использование:\n"
+               "  maze_cli archive-append <архив> <лабиринт.txt>...\n"
+               "  maze_cli archive-list <архив>\n"
+               "  maze_cli archive-extract <архив> <номер> <лабиринт.txt>\n"
+               "  maze_cli index-build <лабиринт.txt> [кластер]\n"
+               "  maze_cli tile-convert <лабиринт.txt> <плитки> [сторона]\n"
+               "  maze_cli tile-solve <плитки> <r1> <c1> <r2> <c2> [кэш]\n"
+               "  maze_cli generator-bench <строки> <столбцы> [повторы]\n"
+               "  maze_cli render <лабиринт.txt> <картинка.png|pbm> [клетка]"
+               " [r1 c1 r2 c2]\n"
+               "  maze_cli memory-report <лабиринт.txt> [r1 c1 r2 c2]\n"
+               "  maze_cli world-path <зерно> <r1> <c1> <r2> <c2> [кусок]\n"
+               "  maze_cli cache-solve <кэш> <лабиринт.txt> <r1> <c1> <r2>"
+               " <c2>\n"
+               "  maze_cli serve <сокет> [потоки]\n"
+               "  maze_cli query <сокет> <запрос>...\n";
+}
+
+int ArchiveAppend(const std::vector<std::string>& args) {
+  if (args.size() < 2) return 2;
+  s21::Model model;
+  s21::Controller controller(&model);
+  for (std::size_t i = 1; i < args.size(); i++) {
+    controller.ReadFromFile(args[i]);
+    long id = controller.AppendToArchive(args[0]);
+    if (id < 0) {
+      std::cerr << "Не удалось дописать архив: " << args[0] << std::endl;
+      return 1;
+    }
+    std::cout << id << " " << args[i] << "\n";
+  }
+  return 0;
+}
+
+int ArchiveList(const std::vector<std::string>& args) {
+  if (args.size() != 1) return 2;
+  s21::MazeArchive archive;
+  if (!archive.Open(args[0])) {
+    std::cerr << "Не удалось открыть архив: " << args[0] << std::endl;
+    return 1;
+  }
+  for (std::size_t id = 0; id < archive.Size(); id++) {
+    const auto& entry = archive.GetEntry(id);
+    std::cout << id << " " << entry.rows << " " << entry.cols << "\n";
+  }
+  return 0;
+}
+
+int ArchiveExtract(const std::vector<std::string>& args) {
+  if (args.size() != 3) return 2;
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromArchive(args[0], std::stoul(args[1]));
+  if (!controller.SaveToFile(args[2])) {
+    std::cerr << "Не удалось сохранить файл: " << args[2] << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int IndexBuild(const std::vector<std::string>& args) {
+  if (args.empty() || args.size() > 2) return 2;
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile(args[0]);
+  controller.BuildPathIndex(args.size() == 2 ? std::stoi(args[1])
+                                             : s21::PathIndex::kDefaultCluster);
+  std::string filename = s21::PathIndex::FileFor(args[0]);
+  if (!controller.SavePathIndex(filename)) {
+    std::cerr << "Не удалось сохранить индекс: " << filename << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int TileConvert(const std::vector<std::string>& args) {
+  if (args.size() < 2 || args.size() > 3) return 2;
+  int tile =
+      args.size() == 3 ? std::stoi(args[2]) : s21::TiledMaze::kDefaultTile;
+  if (!s21::TiledMaze::Convert(args[0], args[1], tile)) {
+    std::cerr << "Не удалось перевести лабиринт в плитки: " << args[0]
+              << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int TileSolve(const std::vector<std::string>& args) {
+  if (args.size() < 5 || args.size() > 6) return 2;
+  s21::TiledMaze maze;
+  std::size_t cache = args.size() == 6 ? std::stoul(args[5])
+                                       : s21::TiledMaze::kDefaultCacheTiles;
+  if (!maze.Open(args[0], cache)) {
+    std::cerr << "Не удалось открыть файл плиток: " << args[0] << std::endl;
+    return 1;
+  }
+  s21::TiledSolver solver;
+  auto path = solver.Solve(&maze, {std::stoi(args[1]), std::stoi(args[2])},
+                           {std::stoi(args[3]), std::stoi(args[4])});
+  std::cout << "длина пути: " << path.size() << "\n"
+            << "загрузок плиток: " << solver.GetTileLoads() << "\n"
+            << "страничных прерываний: " << solver.GetPageFaults() << "\n";
+  return 0;
+}
+
+int GeneratorBench(const std::vector<std::string>& args) {
+  if (args.size() < 2 || args.size() > 3) return 2;
+  int rows = std::stoi(args[0]), cols = std::stoi(args[1]);
+  int repeats = args.size() == 3 ? std::stoi(args[2]) : 3;
+  if (rows <= 0 || cols <= 0 || repeats <= 0) return 2;
+  s21::WallMatrix right, bottom;
+  s21::MazeValidator validator;
+  s21::MazeAnalyzer analyzer;
+  //  setw считает байты, поэтому заголовок выровнен пробелами
+  std::cout << "алгоритм      мс          тупики    развилки  диаметр\n"
+            << std::left;
+  for (s21::GeneratorKind kind : s21::kGeneratorKinds) {
+    auto generator = s21::MakeGenerator(kind, 1);
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; i++) {
+      generator->Generate(rows, cols, &right, &bottom);
+    }
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - begin;
+    s21::MazeStats stats = analyzer.Analyze(right, bottom);
+    bool perfect = validator.Validate(right, bottom).kind ==
+                   s21::MazeValidation::Kind::kPerfect;
+    std::cout << std::setw(14) << s21::GeneratorName(kind) << std::setw(12)
+              << elapsed.count() / repeats << std::setw(10) << stats.dead_ends
+              << std::setw(10) << stats.junctions << stats.diameter
+              << (perfect ? "" : " (не идеальный)") << "\n";
+  }
+  return 0;
+}
+
+int Render(const std::vector<std::string>& args) {
+  if (args.size() != 2 && args.size() != 3 && args.size() != 7) return 2;
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile(args[0]);
+  int cell =
+      args.size() > 2 ? std::stoi(args[2]) : s21::MazeRasterizer::kDefaultCell;
+  if (args.size() == 7) {
+    controller.SetStartPoint({std::stoi(args[3]), std::stoi(args[4])});
+    controller.SetEndPoint({std::stoi(args[5]), std::stoi(args[6])});
+  }
+  if (!controller.ExportImage(args[1], cell, args.size() == 7)) {
+    std::cerr << "Не удалось сохранить изображение: " << args[1] << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+void PrintMemory(const char* name, const s21::MemoryUsage& usage) {
+  std::cout << std::setw(12) << name << std::setw(12) << usage.allocations
+            << std::setw(12) << usage.bytes << usage.peak << "\n";
+}
+
+int MemoryReport(const std::vector<std::string>& args) {
+  if (args.size() != 1 && args.size() != 5) return 2;
+  //  вся память модели берется у арены задания и отдается при ее удалении
+  std::pmr::monotonic_buffer_resource arena;
+  s21::Model model(&arena);
+  model.ReadFromFile(args[0]);
+  int rows = model.GetMazeRows(), cols = model.GetMazeCols();
+  s21::Point start, end(rows - 1, cols - 1);
+  if (args.size() == 5) {
+    start = {std::stoi(args[1]), std::stoi(args[2])};
+    end = {std::stoi(args[3]), std::stoi(args[4])};
+  }
+  std::cout << "операция    выделений   байт        пик\n" << std::left;
+  PrintMemory("load", model.GetMemoryUsage(s21::ModelOperation::kLoad));
+  model.GetPath(start, end);
+  PrintMemory("solve", model.GetMemoryUsage(s21::ModelOperation::kSolve));
+  model.GenerateMaze(rows, cols);
+  PrintMemory("generate",
+              model.GetMemoryUsage(s21::ModelOperation::kGenerate));
+  return 0;
+}
+
+int WorldPath(const std::vector<std::string>& args) {
+  if (args.size() != 5 && args.size() != 6) return 2;
+  s21::ChunkWorld world(
+      std::stoull(args[0]),
+      args.size() == 6 ? std::stoi(args[5]) : s21::ChunkWorld::kDefaultChunk);
+  s21::WorldPoint start{std::stoll(args[1]), std::stoll(args[2])};
+  s21::WorldPoint end{std::stoll(args[3]), std::stoll(args[4])};
+  auto begin = std::chrono::steady_clock::now();
+  auto path = world.GetPath(start, end);
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - begin;
+  if (path.empty()) {
+    std::cerr << "Путь не найден в пределах поиска." << std::endl;
+    return 1;
+  }
+  std::cout << "длина пути: " << path.size() << "\n"
+            << "сгенерировано кусков: " << world.GetGenerated() << "\n"
+            << "мс: " << elapsed.count() << "\n";
+  return 0;
+}
+
+int CacheSolve(const std::vector<std::string>& args) {
+  if (args.size() != 6) return 2;
+  s21::Model model;
+  if (!model.OpenSolveCache(args[0])) {
+    std::cerr << "Не удалось открыть кэш: " << args[0] << std::endl;
+    return 1;
+  }
+  model.ReadFromFile(args[1]);
+  s21::Point start(std::stoi(args[2]), std::stoi(args[3]));
+  s21::Point end(std::stoi(args[4]), std::stoi(args[5]));
+  auto begin = std::chrono::steady_clock::now();
+  auto path = model.GetPath(start, end);
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - begin;
+  std::cout << "хэш: " << std::hex << model.GetHash() << std::dec << "\n"
+            << "длина пути: " << path.size() << "\n"
+            << (model.GetSolveCache()->GetHits() ? "из кэша" : "найден поиском")
+            << ", мс: " << elapsed.count() << "\n";
+  return 0;
+}
+
+int Serve(const std::vector<std::string>& args) {
+  if (args.empty() || args.size() > 2) return 2;
+  s21::MazeServer server(args.size() == 2 ? std::stoi(args[1]) : 0);
+  if (!server.Serve(args[0])) {
+    std::cerr << "Не удалось открыть сокет: " << args[0] << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+int Query(const std::vector<std::string>& args) {
+  if (args.size() < 2) return 2;
+  std::string request = args[1], response;
+  for (std::size_t i = 2; i < args.size(); i++) request += " " + args[i];
+  if (!s21::MazeServer::Request(args[0], request, &response)) {
+    std::cerr << "Сервер не ответил: " << args[0] << std::endl;
+    return 1;
+  }
+  std::cout << response << "\n";
+  return response.rfind("ok", 0) == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    PrintUsage();
+    return 2;
+  }
+  std::string command = argv[1];
+  std::vector<std::string> args(argv + 2, argv + argc);
+  int status = 2;
+  try {
+    if (command == "archive-append") {
+      status = ArchiveAppend(args);
+    } else if (command == "archive-list") {
+      status = ArchiveList(args);
+    } else if (command == "archive-extract") {
+      status = ArchiveExtract(args);
+    } else if (command == "index-build") {
+      status = IndexBuild(args);
+    } else if (command == "tile-convert") {
+      status = TileConvert(args);
+    } else if (command == "tile-solve") {
+      status = TileSolve(args);
+    } else if (command == "generator-bench") {
+      status = GeneratorBench(args);
+    } else if (command == "render") {
+      status = Render(args);
+    } else if (command == "memory-report") {
+      status = MemoryReport(args);
+    } else if (command == "world-path") {
+      status = WorldPath(args);
+    } else if (command == "cache-solve") {
+      status = CacheSolve(args);
+    } else if (command == "serve") {
+      status = Serve(args);
+    } else if (command == "query") {
+      status = Query(args);
+    }
+  } catch (const std::exception& error) {
+    std::cerr << error.what() << std::endl;
+    status = 1;
+  }
+  if (status == 2) PrintUsage();
+  S21_TRACE_DUMP();
+  return status;
+}
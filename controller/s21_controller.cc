@@ -1,15 +1,27 @@
 #include "s21_controller.h"
 
+#include "../model/s21_trace.h"
+
 namespace s21 {
 
 Controller::Controller(Model* model) : model_(model) {}
 
 void Controller::SetMazeSize(int rows, int cols) {
   model_->SetMazeSize(rows, cols);
+  fixed_.reset();
+  index_.Clear();
+  step_.Reset();
 }
 
-void Controller::GenerateMaze(int rows, int cols) {
-  model_->GenerateMaze(rows, cols);
+void Controller::GenerateMaze(int rows, int cols, GeneratorKind kind) {
+  S21_TRACE_SCOPE("Controller::GenerateMaze");
+  index_.Clear();
+  step_.Reset();
+  //  лабиринт строит генератор модели, чтобы SeedGenerator давал
+  //  одинаковые лабиринты любого размера. FixedMaze загружается из готовых
+  //  стен и ускоряет поиск пути
+  model_->GenerateMaze(rows, cols, kind);
+  UpdateFixedMaze();
 }
 
 int Controller::GetMazeRows() { return model_->GetMazeRows(); }
@@ -17,22 +29,238 @@ int Controller::GetMazeRows() { return model_->GetMazeRows(); }
 int Controller::GetMazeCols() { return model_->GetMazeCols(); }
 
 void Controller::ReadFromFile(std::string filename) {
+  S21_TRACE_SCOPE("Controller::ReadFromFile");
   model_->ReadFromFile(filename);
+  UpdateFixedMaze();
+  step_.Reset();
+  index_.Load(PathIndex::FileFor(filename), model_->GetRightBorders(),
+              model_->GetBottomBorders());
+}
+
+bool Controller::SaveToFile(std::string filename) {
+  S21_TRACE_SCOPE("Controller::SaveToFile");
+  return model_->SaveToFile(filename, CompressionFromName(filename));
+}
+
+void Controller::ReadFromArchive(std::string filename, std::size_t id) {
+  S21_TRACE_SCOPE("Controller::ReadFromArchive");
+  MazeArchive archive;
+  if (!archive.Open(filename) || id >= archive.Size()) {
+    std::cerr << "Не удалось прочитать лабиринт " << id << " из архива "
+              << filename << std::endl;
+    exit(1);
+  }
+  model_->ReadFromArchive(archive, id);
+  UpdateFixedMaze();
+  index_.Clear();
+  step_.Reset();
+}
+
+long Controller::AppendToArchive(std::string filename) {
+  return model_->AppendToArchive(filename);
+}
+
+bool Controller::SaveTiled(std::string filename, int tile) {
+  return TiledMaze::Write(filename, model_->GetRightBorders(),
+                          model_->GetBottomBorders(), tile);
+}
+
+std::vector<Point> Controller::SolveTiled(std::string filename,
+                                          const Point& start,
+                                          const Point& end) {
+  TiledMaze maze;
+  if (!maze.Open(filename)) {
+    std::cerr << "Не удалось открыть файл плиток: " << filename << std::endl;
+    exit(1);
+  }
+  return tiled_.Solve(&maze, start, end);
+}
+
+bool Controller::ExportImage(std::string filename, int cell, bool with_path) {
+  S21_TRACE_SCOPE("Controller::ExportImage");
+  rasterizer_.SetCellSize(cell);
+  rasterizer_.ClearOverlay();
+  if (with_path) {
+    rasterizer_.SetPath(GetCompactPath(GetStartPoint(), GetEndPoint()));
+    rasterizer_.SetStart(GetStartPoint());
+    rasterizer_.SetEnd(GetEndPoint());
+  }
+  return rasterizer_.Write(filename, model_->GetRightBorders(),
+                           model_->GetBottomBorders(),
+                           MazeRasterizer::FormatFromName(filename));
 }
 
-const std::vector<std::vector<int>>& Controller::GetRightBorders() {
+void Controller::OpenWorld(std::uint64_t seed, int chunk) {
+  world_ = std::make_unique<ChunkWorld>(seed, chunk);
+}
+
+void Controller::ShowWorld(std::int64_t top, std::int64_t left, int rows,
+                           int cols) {
+  if (!world_) throw std::runtime_error("Бесконечный лабиринт не открыт.");
+  if (rows <= 0 || cols <= 0) {
+    throw std::invalid_argument("Неверные размеры лабиринта.");
+  }
+  WallMatrix right(model_->GetMemoryResource());
+  WallMatrix bottom(model_->GetMemoryResource());
+  world_->CopyWindow(top, left, rows, cols, &right, &bottom);
+  model_->SetBorders(std::move(right), std::move(bottom));
+  UpdateFixedMaze();
+  index_.Clear();
+  step_.Reset();
+  int chunk = world_->GetChunkSize();
+  world_->Prefetch({top + rows / 2, left + cols / 2},
+                   (std::max(rows, cols) / 2 + chunk - 1) / chunk + 1);
+}
+
+std::vector<WorldPoint> Controller::GetWorldPath(const WorldPoint& start,
+                                                 const WorldPoint& end) {
+  if (!world_) throw std::runtime_error("Бесконечный лабиринт не открыт.");
+  return world_->GetPath(start, end);
+}
+
+void Controller::StartStepSolve(const Point& start, const Point& end) {
+  S21_TRACE_SCOPE("Controller::StartStepSolve");
+  step_.Start(model_->GetRightBorders(), model_->GetBottomBorders(), start,
+              end);
+}
+
+const WallMatrix& Controller::GetRightBorders() {
   return model_->GetRightBorders();
 }
 
-const std::vector<std::vector<int>>& Controller::GetBottomBorders() {
+const WallMatrix& Controller::GetBottomBorders() {
   return model_->GetBottomBorders();
 }
 
-void Controller::ClearData() { model_->ClearData(); }
+void Controller::ToggleRightWall(int row, int col) {
+  model_->ToggleRightWall(row, col);
+  index_.Clear();
+  step_.Reset();
+  //  fixed_ перезагружается только при запросе не из начальной точки
+  fixed_stale_ = true;
+}
+
+void Controller::ToggleBottomWall(int row, int col) {
+  model_->ToggleBottomWall(row, col);
+  index_.Clear();
+  step_.Reset();
+  fixed_stale_ = true;
+}
+
+MazeValidation Controller::Validate() { return model_->Validate(); }
+
+int Controller::RepairMaze() {
+  S21_TRACE_SCOPE("Controller::RepairMaze");
+  int changed = model_->RepairMaze();
+  UpdateFixedMaze();
+  if (changed) {
+    index_.Clear();
+    step_.Reset();
+  }
+  return changed;
+}
+
+void Controller::ClearData() {
+  model_->ClearData();
+  fixed_.reset();
+  index_.Clear();
+  step_.Reset();
+}
+
+void Controller::BuildPathIndex(int cluster) {
+  S21_TRACE_SCOPE("Controller::BuildPathIndex");
+  index_.Build(model_->GetRightBorders(), model_->GetBottomBorders(), cluster);
+}
+
+bool Controller::SavePathIndex(std::string filename) {
+  return index_.Save(filename);
+}
+
+bool Controller::LoadPathIndex(std::string filename) {
+  return index_.Load(filename, model_->GetRightBorders(),
+                     model_->GetBottomBorders());
+}
 
 const std::vector<Point> Controller::GetPath(const Point& start,
                                              const Point& end) {
+  S21_TRACE_SCOPE("Controller::GetPath");
+  //  после правок стен путь из начальной точки берется из поля расстояний
+  //  модели, которое чинится по разнице, без перезагрузки fixed_
+  bool from_field = fixed_stale_ && model_->HasDistanceField(start);
+  bool inside = IsInside(start) && IsInside(end);
+  bool from_fixed = fixed_ && !from_field && inside;
+  bool from_index = !from_fixed && index_.IsValid() && inside;
+  //  модель сама сверяется с кэшем путей, ответы fixed_ и индекса
+  //  кэшируются здесь
+  if (from_fixed || from_index) {
+    SolveCache* cache = model_->GetSolveCache();
+    std::vector<Point> path;
+    if (cache && cache->FindPath(model_->GetHash(), start, end, &path)) {
+      return path;
+    }
+    if (from_fixed) {
+      if (fixed_stale_) {
+        fixed_->Load(model_->GetRightBorders(), model_->GetBottomBorders());
+        fixed_stale_ = false;
+      }
+      path = fixed_->GetPath(start, end);
+    } else {
+      path = index_.GetPath(model_->GetRightBorders(),
+                            model_->GetBottomBorders(), start, end);
+    }
+    if (cache) cache->StorePath(model_->GetHash(), start, end, path);
+    return path;
+  }
   return model_->GetPath(start, end);  // Метод для получения пути из модели
 }
 
+CompactPath Controller::GetCompactPath(const Point& start, const Point& end) {
+  return CompactPath::Encode(GetPath(start, end));
+}
+
+PathBatch Controller::GetPaths(
+    const std::vector<std::pair<Point, Point>>& queries) {
+  S21_TRACE_SCOPE("Controller::GetPaths");
+  return batch_.Solve(model_->GetRightBorders(), model_->GetBottomBorders(),
+                      queries);
+}
+
+WeightedPath Controller::GetWeightedPath(const Point& start,
+                                         const Point& end) {
+  S21_TRACE_SCOPE("Controller::GetWeightedPath");
+  return weighted_.Solve(model_->GetRightBorders(), model_->GetBottomBorders(),
+                         model_->HasCosts() ? &model_->GetCosts() : nullptr,
+                         start, end);
+}
+
+MazeStats Controller::GetStats() {
+  S21_TRACE_SCOPE("Controller::GetStats");
+  MazeStats stats;
+  SolveCache* cache = model_->GetSolveCache();
+  if (cache && cache->FindStats(model_->GetHash(), &stats)) return stats;
+  stats = analyzer_.Analyze(model_->GetRightBorders(),
+                            model_->GetBottomBorders());
+  if (cache) cache->StoreStats(model_->GetHash(), stats);
+  return stats;
+}
+
+DistanceStats Controller::GetDistanceStats(const Point& from) {
+  S21_TRACE_SCOPE("Controller::GetDistanceStats");
+  return analyzer_.Distances(model_->GetRightBorders(),
+                             model_->GetBottomBorders(), from);
+}
+
+void Controller::UpdateFixedMaze() {
+  fixed_ = MakeFixedMaze(model_->GetMazeRows(), model_->GetMazeCols());
+  fixed_stale_ = false;
+  if (fixed_) {
+    fixed_->Load(model_->GetRightBorders(), model_->GetBottomBorders());
+  }
+}
+
+bool Controller::IsInside(const Point& point) {
+  return point.row >= 0 && point.col >= 0 &&
+         point.row < model_->GetMazeRows() && point.col < model_->GetMazeCols();
+}
+
 }  // namespace s21
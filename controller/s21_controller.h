@@ -1,7 +1,18 @@
 #ifndef SRC_CONTROLLER_S21_CONTROLLER_H_
 #define SRC_CONTROLLER_S21_CONTROLLER_H_
 
+#include <memory>
+
+#include "../model/s21_batch_solver.h"
+#include "../model/s21_chunk_world.h"
+#include "../model/s21_fixed_maze.h"
+#include "../model/s21_maze_stats.h"
 #include "../model/s21_model.h"
+#include "../model/s21_path_index.h"
+#include "../model/s21_rasterizer.h"
+#include "../model/s21_step_solver.h"
+#include "../model/s21_tiled_solver.h"
+#include "../model/s21_weighted_solver.h"
 
 namespace s21 {
 class Controller {
@@ -28,34 +39,230 @@ class Controller {
   int GetMazeCols();
   /**
    * Метод генерации случайного лабиринта с параметрами ширины и высоты
+   * генератором модели, небольшие лабиринты затем загружаются в
+   * специализацию FixedMaze
    * @param rows - ширина лабиринта
    * @param cols - высота лабиринта
+   * @param kind - алгоритм генерации
    */
-  void GenerateMaze(int rows, int cols);
+  void GenerateMaze(int rows, int cols,
+                    GeneratorKind kind = GeneratorKind::kEller);
   /**
    * Метод считывания лабиринта из файла
    * @param filename - имя файла
    */
   void ReadFromFile(std::string filename);
+  /**
+   * Метод сохранения лабиринта в файл, сжатие выбирается по расширению
+   * @param filename - имя файла
+   * @return - успешно ли сохранение
+   */
+  bool SaveToFile(std::string filename);
+  /**
+   * Метод чтения лабиринта из архива
+   * @param filename - имя файла архива
+   * @param id - номер лабиринта в архиве
+   */
+  void ReadFromArchive(std::string filename, std::size_t id);
+  /**
+   * Метод добавления лабиринта в конец архива
+   * @param filename - имя файла архива
+   * @return - номер лабиринта в архиве или -1 при ошибке
+   */
+  long AppendToArchive(std::string filename);
+  /**
+   * Метод сохранения лабиринта в файл плиток для поиска путей без
+   * загрузки всего лабиринта в память
+   * @param filename - имя файла плиток
+   * @param tile - сторона плитки
+   * @return - успешно ли сохранение
+   */
+  bool SaveTiled(std::string filename, int tile = TiledMaze::kDefaultTile);
+  /**
+   * Метод поиска пути в лабиринте из файла плиток
+   * @param filename - имя файла плиток
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь
+   */
+  std::vector<Point> SolveTiled(std::string filename, const Point& start,
+                                const Point& end);
+  /**
+   * Метод получения поиска по плиткам со счетчиками последнего поиска
+   */
+  const TiledSolver& GetTiledSolver() const { return tiled_; }
+  /**
+   * Метод записи изображения лабиринта, формат выбирается по расширению
+   * (.pbm или PNG)
+   * @param filename - имя файла
+   * @param cell - сторона клетки в пикселях
+   * @param with_path - рисовать ли путь между начальной и конечной точками
+   * @return - успешна ли запись
+   */
+  bool ExportImage(std::string filename,
+                   int cell = MazeRasterizer::kDefaultCell,
+                   bool with_path = false);
+  /**
+   * Метод открытия бесконечного лабиринта из кусков
+   * @param seed - зерно мира
+   * @param chunk - сторона куска
+   */
+  void OpenWorld(std::uint64_t seed, int chunk = ChunkWorld::kDefaultChunk);
+  /**
+   * Метод загрузки прямоугольника бесконечного лабиринта в модель. Куски
+   * вокруг прямоугольника генерируются заранее в фоне, чтобы следующий
+   * сдвиг брал их из кэша
+   * @param top - строка верхнего левого угла
+   * @param left - столбец верхнего левого угла
+   * @param rows - число строк
+   * @param cols - число столбцов
+   */
+  void ShowWorld(std::int64_t top, std::int64_t left, int rows, int cols);
+  /**
+   * Метод поиска пути в бесконечном лабиринте
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь от конечной точки к начальной
+   */
+  std::vector<WorldPoint> GetWorldPath(const WorldPoint& start,
+                                       const WorldPoint& end);
+  /**
+   * Метод получения бесконечного лабиринта или nullptr, если он не открыт
+   */
+  ChunkWorld* GetWorld() { return world_.get(); }
+  /**
+   * Метод начала поиска пути по частям для показа волны. Поиск
+   * останавливается при любом изменении лабиринта
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   */
+  void StartStepSolve(const Point& start, const Point& end);
+  /**
+   * Метод получения поиска по частям, начатого StartStepSolve
+   */
+  StepSolver& GetStepSolver() { return step_; }
   /**
    * Метод получения матрицы заполнения лабиринта стенами справа
    */
-  const std::vector<std::vector<int>>& GetRightBorders();
+  const WallMatrix& GetRightBorders();
   /**
    * Метод получения матрицы заполнения лабиринта снизу
    */
-  const std::vector<std::vector<int>>& GetBottomBorders();
+  const WallMatrix& GetBottomBorders();
+  /**
+   * Метод переключения стены справа от клетки
+   * @param row - индекс строки
+   * @param col - индекс столбца
+   */
+  void ToggleRightWall(int row, int col);
+  /**
+   * Метод переключения стены снизу от клетки
+   * @param row - индекс строки
+   * @param col - индекс столбца
+   */
+  void ToggleBottomWall(int row, int col);
+  /**
+   * Метод проверки лабиринта
+   * @return - результат проверки
+   */
+  MazeValidation Validate();
+  /**
+   * Метод превращения лабиринта в идеальный
+   * @return - число измененных стен
+   */
+  int RepairMaze();
   /**
    * Метод очистки данных
    */
   void ClearData();
   /**
-   * Метод получения пути из модели
+   * Метод построения иерархического индекса путей для текущего лабиринта.
+   * Индекс сбрасывается при любом изменении лабиринта
+   * @param cluster - сторона кластера в клетках
+   */
+  void BuildPathIndex(int cluster = PathIndex::kDefaultCluster);
+  /**
+   * Метод сохранения индекса путей в файл
+   * @param filename - имя файла
+   * @return - успешно ли сохранение
+   */
+  bool SavePathIndex(std::string filename);
+  /**
+   * Метод чтения индекса путей из файла
+   * @param filename - имя файла
+   * @return - удалось ли прочитать индекс для текущего лабиринта
+   */
+  bool LoadPathIndex(std::string filename);
+  /**
+   * Метод проверки, построен ли индекс путей
+   */
+  bool HasPathIndex() const { return index_.IsValid(); }
+  /**
+   * Метод проверки, отстает ли быстрый лабиринт фиксированного размера от
+   * правок стен. Он перезагружается при первом запросе пути не из
+   * начальной точки
+   */
+  bool IsFixedMazeStale() const { return fixed_stale_; }
+  /**
+   * Метод получения пути из FixedMaze, индекса путей или из модели. С
+   * открытым кэшем путь сначала ищется в нем, найденный путь сохраняется
    * @param start - координаты начальной точки
    * @param end - координаты конечной точки
    * @return - путь
    */
   const std::vector<Point> GetPath(const Point& start, const Point& end);
+  /**
+   * Метод получения пути в компактном виде: начальная точка и серии ходов
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь
+   */
+  CompactPath GetCompactPath(const Point& start, const Point& end);
+  /**
+   * Метод поиска путей для пакета пар точек. Запросы с общей начальной
+   * точкой решаются одним обходом, группы решаются параллельно
+   * @param queries - пары начальной и конечной точек
+   * @return - пути в одном буфере, каждый в формате GetPath
+   */
+  PathBatch GetPaths(const std::vector<std::pair<Point, Point>>& queries);
+  /**
+   * Метод установки стоимостей входа в клетки
+   * @param costs - матрица стоимостей или пустая матрица для единичных
+   * стоимостей
+   */
+  void SetCosts(CostMatrix costs) { model_->SetCosts(std::move(costs)); }
+  /**
+   * Метод проверки, заданы ли стоимости клеток
+   */
+  bool HasCosts() const { return model_->HasCosts(); }
+  /**
+   * Метод поиска пути наименьшей стоимости по стоимостям клеток модели.
+   * Без стоимостей длина пути совпадает с длиной пути GetPath
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь от конечной точки к начальной и его стоимость
+   */
+  WeightedPath GetWeightedPath(const Point& start, const Point& end);
+  /**
+   * Метод открытия кэша путей и статистики в файле, см. Model::OpenSolveCache
+   * @param filename - имя файла кэша
+   * @return - удалось ли открыть кэш
+   */
+  bool OpenSolveCache(std::string filename) {
+    return model_->OpenSolveCache(filename);
+  }
+  /**
+   * Метод подсчета статистики лабиринта: диаметр, тупики, коридоры и
+   * развилки. С открытым кэшем статистика сначала ищется в нем
+   * @return - статистика лабиринта
+   */
+  MazeStats GetStats();
+  /**
+   * Метод подсчета статистики расстояний от клетки
+   * @param from - исходная клетка
+   * @return - среднее и наибольшее расстояние
+   */
+  DistanceStats GetDistanceStats(const Point& from);
   /**
    * Метод установки координат начальной точки для поиска пути
    * @param start - координаты начальной точки
@@ -78,7 +285,27 @@ class Controller {
   const Point& GetEndPoint() const { return model_->GetEndPoint(); }
 
  private:
+  /**
+   * Метод выбора специализации FixedMaze под текущий лабиринт модели
+   */
+  void UpdateFixedMaze();
+  /**
+   * Метод проверки, что точка лежит внутри лабиринта
+   */
+  bool IsInside(const Point& point);
+
   Model* model_ = nullptr;
+  std::unique_ptr<FixedMazeBase> fixed_;
+  //  стены правились после загрузки fixed_
+  bool fixed_stale_ = false;
+  BatchSolver batch_;
+  MazeAnalyzer analyzer_;
+  PathIndex index_;
+  TiledSolver tiled_;
+  MazeRasterizer rasterizer_;
+  std::unique_ptr<ChunkWorld> world_;
+  StepSolver step_;
+  WeightedSolver weighted_;
 };
 }  // namespace s21
 
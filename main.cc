@@ -1,5 +1,6 @@
 #include <QApplication>
 
+#include "model/s21_trace.h"
 #include "view/s21_view.h"
 
 int main(int argc, char *argv[]) {
@@ -8,5 +9,7 @@ int main(int argc, char *argv[]) {
   s21::Controller controller(&model);
   s21::View view(&controller);
   view.show();
-  return app.exec();
+  int status = app.exec();
+  S21_TRACE_DUMP();
+  return status;
 }
@@ -0,0 +1,87 @@
+#include "s21_batch_solver.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "s21_trace.h"
+
+namespace s21 {
+
+namespace {
+
+//  расположение пути запроса в буфере потока
+struct Span {
+  int worker;
+  std::size_t begin;
+  std::size_t length;
+};
+
+}  // namespace
+
+BatchSolver::BatchSolver(int threads) : threads_(threads) {}
+
+PathBatch BatchSolver::Solve(
+    const WallMatrix& right, const WallMatrix& bottom,
+    const std::vector<std::pair<Point, Point>>& queries) {
+  S21_TRACE_SCOPE("BatchSolver::Solve");
+  int rows = right.size();
+  int cols = rows ? right[0].size() : 0;
+  auto inside = [rows, cols](const Point& p) {
+    return p.row >= 0 && p.col >= 0 && p.row < rows && p.col < cols;
+  };
+  for (const auto& query : queries) {
+    if (!inside(query.first) || !inside(query.second)) {
+      throw std::invalid_argument("Неверные координаты точек.");
+    }
+  }
+
+  //  группы запросов с общей начальной точкой
+  auto source = [cols, &queries](std::size_t i) {
+    return queries[i].first.row * cols + queries[i].first.col;
+  };
+  std::vector<std::size_t> order(queries.size());
+  for (std::size_t i = 0; i < order.size(); i++) order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [&source](std::size_t a, std::size_t b) {
+                     return source(a) < source(b);
+                   });
+  std::vector<std::size_t> groups;
+  for (std::size_t i = 0; i < order.size(); i++) {
+    if (i == 0 || source(order[i]) != source(order[i - 1])) groups.push_back(i);
+  }
+  groups.push_back(order.size());
+
+  if (!pool_) pool_ = std::make_unique<ThreadPool>(threads_);
+  fields_.resize(pool_->Size());
+  buffers_.resize(pool_->Size());
+  for (auto& buffer : buffers_) buffer.clear();
+
+  std::vector<Span> spans(queries.size());
+  pool_->ParallelFor(groups.size() - 1, [&](std::size_t group, int worker) {
+    S21_TRACE_SCOPE("BatchSolver::SolveGroup");
+    DistanceField& field = fields_[worker];
+    std::vector<Point>& buffer = buffers_[worker];
+    field.Build(right, bottom, queries[order[groups[group]]].first);
+    for (std::size_t i = groups[group]; i < groups[group + 1]; i++) {
+      std::size_t begin = buffer.size();
+      std::size_t length =
+          field.AppendPath(right, bottom, queries[order[i]].second, &buffer);
+      spans[order[i]] = {worker, begin, length};
+    }
+  });
+
+  PathBatch batch;
+  batch.offsets.resize(queries.size() + 1, 0);
+  for (std::size_t i = 0; i < queries.size(); i++) {
+    batch.offsets[i + 1] = batch.offsets[i] + spans[i].length;
+  }
+  batch.points.resize(batch.offsets.back());
+  for (std::size_t i = 0; i < queries.size(); i++) {
+    const Point* from = buffers_[spans[i].worker].data() + spans[i].begin;
+    std::copy(from, from + spans[i].length,
+              batch.points.begin() + batch.offsets[i]);
+  }
+  return batch;
+}
+
+}  // namespace s21
@@ -0,0 +1,77 @@
+#ifndef SRC_MODEL_S21_BATCH_SOLVER_H_
+#define SRC_MODEL_S21_BATCH_SOLVER_H_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "s21_distance_field.h"
+#include "s21_memory.h"
+#include "s21_point.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+/**
+ * Пути пакета запросов в одном непрерывном буфере: путь запроса i
+ * занимает points[offsets[i]] ... points[offsets[i + 1] - 1]
+ */
+struct PathBatch {
+  /**
+   * Смещения путей в буфере точек, на одно больше числа запросов
+   */
+  std::vector<std::size_t> offsets;
+  /**
+   * Точки всех путей подряд, каждый путь от конечной точки к начальной
+   */
+  std::vector<Point> points;
+  /**
+   * Метод получения числа путей
+   */
+  std::size_t Size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+  /**
+   * Метод получения длины пути запроса
+   * @param i - номер запроса
+   */
+  std::size_t Length(std::size_t i) const {
+    return offsets[i + 1] - offsets[i];
+  }
+  /**
+   * Метод получения начала пути запроса
+   * @param i - номер запроса
+   */
+  const Point* Path(std::size_t i) const { return points.data() + offsets[i]; }
+};
+
+/**
+ * Поиск путей для множества пар точек одного лабиринта. Запросы
+ * группируются по начальной точке, каждая группа решается одним обходом,
+ * группы распределяются по потокам пула
+ */
+class BatchSolver {
+ public:
+  /**
+   * Конструктор
+   * @param threads - число потоков, 0 - по числу ядер
+   */
+  explicit BatchSolver(int threads = 0);
+  /**
+   * Метод поиска путей
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param queries - пары начальной и конечной точек
+   * @return - пути в формате Model::GetPath
+   */
+  PathBatch Solve(const WallMatrix& right, const WallMatrix& bottom,
+                  const std::vector<std::pair<Point, Point>>& queries);
+
+ private:
+  int threads_;
+  std::unique_ptr<ThreadPool> pool_;
+  std::vector<DistanceField> fields_;
+  std::vector<std::vector<Point>> buffers_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_BATCH_SOLVER_H_
@@ -0,0 +1,240 @@
+#include "s21_cave.h"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace s21 {
+
+namespace {
+
+constexpr Cave::Word kAllAlive = ~Cave::Word{0};
+
+//  полный сумматор над битовыми плоскостями
+inline void FullAdd(Cave::Word a, Cave::Word b, Cave::Word c, Cave::Word* sum,
+                    Cave::Word* carry) {
+  Cave::Word ab = a ^ b;
+  *sum = ab ^ c;
+  *carry = (a & b) | (c & ab);
+}
+
+//  маска клеток, у которых число соседей равно value
+inline Cave::Word CountEquals(const Cave::Word (&bits)[4], int value) {
+  Cave::Word mask = kAllAlive;
+  for (int i = 0; i < 4; i++) {
+    mask &= ((value >> i) & 1) ? bits[i] : ~bits[i];
+  }
+  return mask;
+}
+
+}  // namespace
+
+Cave::Cave() {}
+
+void Cave::SetLimits(int birth, int death) {
+  if (birth < 0 || birth > 7 || death < 0 || death > 7) {
+    throw std::invalid_argument("Пределы должны быть в диапазоне от 0 до 7.");
+  }
+  birth_ = birth;
+  death_ = death;
+}
+
+void Cave::SetThreads(int threads) {
+  if (threads < 0) {
+    throw std::invalid_argument("Неверное число потоков.");
+  }
+  threads_ = threads;
+}
+
+int Cave::GetCaveRows() const { return rows_; }
+
+int Cave::GetCaveCols() const { return cols_; }
+
+bool Cave::IsAlive(int row, int col) const {
+  return (cells_[row * words_ + col / 64] >> (col % 64)) & 1;
+}
+
+void Cave::SetAlive(int row, int col, bool alive) {
+  Word& word = cells_[row * words_ + col / 64];
+  Word bit = Word{1} << (col % 64);
+  word = alive ? word | bit : word & ~bit;
+}
+
+std::vector<std::vector<int>> Cave::GetCells() const {
+  std::vector<std::vector<int>> cells(rows_, std::vector<int>(cols_));
+  for (int i = 0; i < rows_; i++)
+    for (int j = 0; j < cols_; j++) cells[i][j] = IsAlive(i, j);
+  return cells;
+}
+
+void Cave::PadRow(Word* row) const {
+  if (cols_ % 64 != 0) {
+    row[words_ - 1] |= kAllAlive << (cols_ % 64);
+  }
+}
+
+void Cave::GenerateCave(int rows, int cols, int chance) {
+  if (rows <= 0 || cols <= 0 || chance < 0 || chance > 100) {
+    throw std::invalid_argument("Неверные параметры пещеры.");
+  }
+  rows_ = rows;
+  cols_ = cols;
+  words_ = (cols_ + 63) / 64;
+  cells_.assign(rows_ * words_, 0);
+  border_.assign(words_, kAllAlive);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> distribution(0, 99);
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) {
+      SetAlive(i, j, distribution(gen) < chance);
+    }
+    PadRow(&cells_[i * words_]);
+  }
+}
+
+void Cave::ReadFromFile(std::string filename) {
+  std::ifstream file(filename);
+
+  if (!file.is_open()) {
+    std::cerr << "Не удалось открыть файл: " << filename << std::endl;
+    exit(1);
+  }
+
+  if (!(file >> rows_ >> cols_)) {
+    std::cerr << "Ошибка при считывании размеров пещеры." << std::endl;
+    exit(1);
+  }
+
+  if (rows_ <= 0 || cols_ <= 0) {
+    std::cerr << "Размеры должны быть больше нуля." << std::endl;
+    exit(1);
+  }
+
+  words_ = (cols_ + 63) / 64;
+  cells_.assign(rows_ * words_, 0);
+  border_.assign(words_, kAllAlive);
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) {
+      int element = 0;
+      file >> element;
+      SetAlive(i, j, element != 0);
+    }
+    PadRow(&cells_[i * words_]);
+  }
+
+  file.close();
+}
+
+void Cave::SaveToFile(std::string filename) const {
+  std::ofstream file(filename);
+
+  if (!file.is_open()) {
+    std::cerr << "Не удалось открыть файл: " << filename << std::endl;
+    exit(1);
+  }
+
+  file << rows_ << " " << cols_ << "\n";
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) file << IsAlive(i, j) << " ";
+    file << "\n";
+  }
+  file.close();
+}
+
+bool Cave::StepBand(int begin, int end) {
+  bool changed = false;
+  Word lower = 0, greater = 0;  // отбор значений счетчика под правила
+  for (int i = 0; i < 9; i++) {
+    if (i < death_) lower |= Word{1} << i;
+    if (i > birth_) greater |= Word{1} << i;
+  }
+
+  for (int r = begin; r < end; r++) {
+    const Word* rows[3] = {
+        r > 0 ? &cells_[(r - 1) * words_] : border_.data(),
+        &cells_[r * words_],
+        r < rows_ - 1 ? &cells_[(r + 1) * words_] : border_.data(),
+    };
+    Word* out = &next_[r * words_];
+
+    for (int w = 0; w < words_; w++) {
+      //  восемь масок соседей: сдвиги строк выше, текущей и ниже
+      Word n[8];
+      int k = 0;
+      for (int i = 0; i < 3; i++) {
+        Word x = rows[i][w];
+        Word prev = w > 0 ? rows[i][w - 1] >> 63 : 1;
+        Word next = w + 1 < words_ ? rows[i][w + 1] << 63 : Word{1} << 63;
+        n[k++] = (x << 1) | prev;
+        n[k++] = (x >> 1) | next;
+        if (i != 1) n[k++] = x;
+      }
+
+      //  сложение восьми битовых плоскостей в четырехбитный счетчик
+      Word s_a, c_a, s_b, c_b, c_d, t, c_e, c_f;
+      FullAdd(n[0], n[1], n[2], &s_a, &c_a);
+      FullAdd(n[3], n[4], n[5], &s_b, &c_b);
+      Word s_c = n[6] ^ n[7], c_c = n[6] & n[7];
+      Word bits[4];
+      FullAdd(s_a, s_b, s_c, &bits[0], &c_d);
+      FullAdd(c_a, c_b, c_c, &t, &c_e);
+      bits[1] = t ^ c_d;
+      c_f = t & c_d;
+      bits[2] = c_e ^ c_f;
+      bits[3] = c_e & c_f;
+
+      Word dies = 0, born = 0;
+      for (int v = 0; v < 9; v++) {
+        if ((lower >> v) & 1) dies |= CountEquals(bits, v);
+        if ((greater >> v) & 1) born |= CountEquals(bits, v);
+      }
+      Word cur = rows[1][w];
+      out[w] = (cur & ~dies) | (~cur & born);
+    }
+    PadRow(out);
+    changed = changed || !std::equal(out, out + words_, rows[1]);
+  }
+  return changed;
+}
+
+bool Cave::Step() {
+  if (rows_ == 0) return false;
+  next_.resize(cells_.size());
+
+  int threads = threads_ ? threads_ : std::thread::hardware_concurrency();
+  threads = std::max(1, std::min(threads, rows_ / kMinBandRows));
+  int band = (rows_ + threads - 1) / threads;
+
+  std::vector<char> changed(threads, 0);
+  std::vector<std::thread> workers;
+  for (int i = 1; i < threads; i++) {
+    workers.emplace_back([this, &changed, i, band] {
+      changed[i] = StepBand(i * band, std::min(rows_, (i + 1) * band));
+    });
+  }
+  changed[0] = StepBand(0, std::min(rows_, band));
+  for (auto& worker : workers) worker.join();
+
+  cells_.swap(next_);
+  return std::find(changed.begin(), changed.end(), 1) != changed.end();
+}
+
+int Cave::Run(int steps) {
+  int done = 0;
+  while (done < steps && Step()) done++;
+  return done;
+}
+
+void Cave::ClearData() {
+  cells_.clear();
+  next_.clear();
+  border_.clear();
+  rows_ = 0;
+  cols_ = 0;
+  words_ = 0;
+}
+
+}  // namespace s21
@@ -0,0 +1,127 @@
+#ifndef SRC_MODEL_S21_CAVE_H_
+#define SRC_MODEL_S21_CAVE_H_
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * Пещера, генерируемая клеточным автоматом с правилами рождения и смерти.
+ * Клетки хранятся битовыми строками по 64 клетки в слове, соседи считаются
+ * параллельно для всего слова побитовыми сумматорами.
+ */
+class Cave {
+ public:
+  /**
+   * Тип слова битовой строки
+   */
+  using Word = std::uint64_t;
+  /**
+   * Минимальное число строк на один поток при расчете поколения
+   */
+  static constexpr int kMinBandRows = 64;
+
+  /**
+   * Конструктор пещеры
+   */
+  Cave();
+  /**
+   * Метод установки пределов рождения и смерти
+   * @param birth - мертвая клетка оживает, если живых соседей больше birth
+   * @param death - живая клетка умирает, если живых соседей меньше death
+   */
+  void SetLimits(int birth, int death);
+  /**
+   * Метод установки числа потоков, 0 - по числу ядер
+   * @param threads - число потоков
+   */
+  void SetThreads(int threads);
+  /**
+   * Метод получения числа строк пещеры
+   */
+  int GetCaveRows() const;
+  /**
+   * Метод получения числа столбцов пещеры
+   */
+  int GetCaveCols() const;
+  /**
+   * Метод проверки, жива ли клетка
+   * @param row - индекс строки
+   * @param col - индекс столбца
+   */
+  bool IsAlive(int row, int col) const;
+  /**
+   * Метод установки состояния клетки
+   * @param row - индекс строки
+   * @param col - индекс столбца
+   * @param alive - жива ли клетка
+   */
+  void SetAlive(int row, int col, bool alive);
+  /**
+   * Метод получения матрицы клеток (1 - живая клетка)
+   */
+  std::vector<std::vector<int>> GetCells() const;
+  /**
+   * Метод генерации случайной пещеры
+   * @param rows - число строк
+   * @param cols - число столбцов
+   * @param chance - шанс начальной инициализации клетки в процентах
+   */
+  void GenerateCave(int rows, int cols, int chance);
+  /**
+   * Метод считывания пещеры из файла
+   * @param filename - имя файла
+   */
+  void ReadFromFile(std::string filename);
+  /**
+   * Метод сохранения пещеры в файл
+   * @param filename - имя файла
+   */
+  void SaveToFile(std::string filename) const;
+  /**
+   * Метод расчета одного поколения
+   * @return - изменилась ли пещера
+   */
+  bool Step();
+  /**
+   * Метод расчета нескольких поколений, останавливается на стабильной пещере
+   * @param steps - число поколений
+   * @return - число поколений, изменивших пещеру
+   */
+  int Run(int steps);
+  /**
+   * Метод очистки пещеры
+   */
+  void ClearData();
+
+ protected:
+  /**
+   * Метод расчета поколения для полосы строк
+   * @param begin - первая строка полосы
+   * @param end - строка после последней строки полосы
+   * @return - изменилась ли полоса
+   */
+  bool StepBand(int begin, int end);
+  /**
+   * Метод заполнения незначащих битов последнего слова строки живыми
+   * клетками, за границей пещеры клетки считаются живыми
+   * @param row - строка слов
+   */
+  void PadRow(Word* row) const;
+
+ private:
+  int rows_ = 0;
+  int cols_ = 0;
+  int words_ = 0;
+  int birth_ = 4;
+  int death_ = 3;
+  int threads_ = 0;
+  std::vector<Word> cells_, next_, border_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_CAVE_H_
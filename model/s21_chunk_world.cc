@@ -0,0 +1,251 @@
+#include "s21_chunk_world.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+#include "s21_generator.h"
+
+namespace s21 {
+
+namespace {
+
+//  независимые числа для куска и его границ
+enum Salt : std::uint64_t { kRightOpening, kBottomOpening, kMaze };
+
+std::uint64_t Mix(std::uint64_t seed, std::int64_t row, std::int64_t col,
+                  std::uint64_t salt) {
+  SplitMix64 rng(seed ^
+                 static_cast<std::uint64_t>(row) * 0xD6E8FEB86659FD93ULL ^
+                 static_cast<std::uint64_t>(col) * 0xA0761D6478BD642FULL ^
+                 salt * 0xE7037ED1A0B428DBULL);
+  return rng.Next();
+}
+
+std::int64_t FloorDiv(std::int64_t value, int divisor) {
+  std::int64_t quotient = value / divisor;
+  return quotient * divisor > value ? quotient - 1 : quotient;
+}
+
+std::uint64_t Distance(std::int64_t a, std::int64_t b) {
+  return a < b ? b - a : a - b;
+}
+
+}  // namespace
+
+std::size_t ChunkWorld::KeyHash::operator()(const Key& key) const {
+  return Mix(0, key.row, key.col, 0);
+}
+
+ChunkWorld::ChunkWorld(std::uint64_t seed, int chunk, std::size_t cache_chunks,
+                       int threads)
+    : seed_(seed),
+      chunk_(chunk),
+      capacity_(cache_chunks ? cache_chunks : 1),
+      threads_(threads) {
+  if (chunk < 2) {
+    throw std::invalid_argument("Сторона куска должна быть не меньше 2.");
+  }
+}
+
+ChunkWorld::~ChunkWorld() { Wait(); }
+
+bool ChunkWorld::HasRightWall(std::int64_t row, std::int64_t col) {
+  int r, c;
+  return GetChunk(Locate(row, col, &r, &c))->right[r][c];
+}
+
+bool ChunkWorld::HasBottomWall(std::int64_t row, std::int64_t col) {
+  int r, c;
+  return GetChunk(Locate(row, col, &r, &c))->bottom[r][c];
+}
+
+void ChunkWorld::CopyWindow(std::int64_t top, std::int64_t left, int rows,
+                            int cols, WallMatrix* right, WallMatrix* bottom) {
+  right->assign(rows, WallRow(cols));
+  bottom->assign(rows, WallRow(cols));
+  //  копирование по кускам, каждый кусок берется из кэша один раз
+  for (int i = 0; i < rows;) {
+    int r, c;
+    Locate(top + i, left, &r, &c);
+    int height = std::min(rows - i, chunk_ - r);
+    for (int j = 0; j < cols;) {
+      Key key = Locate(top + i, left + j, &r, &c);
+      int width = std::min(cols - j, chunk_ - c);
+      std::shared_ptr<const Chunk> chunk = GetChunk(key);
+      for (int k = 0; k < height; k++) {
+        std::copy_n(chunk->right[r + k].begin() + c, width,
+                    (*right)[i + k].begin() + j);
+        std::copy_n(chunk->bottom[r + k].begin() + c, width,
+                    (*bottom)[i + k].begin() + j);
+      }
+      j += width;
+    }
+    i += height;
+  }
+  for (int i = 0; i < rows; i++) (*right)[i][cols - 1] = 1;
+  if (rows) {
+    std::fill((*bottom)[rows - 1].begin(), (*bottom)[rows - 1].end(), 1);
+  }
+}
+
+void ChunkWorld::Prefetch(const WorldPoint& center, int radius) {
+  int r, c;
+  Key middle = Locate(center.row, center.col, &r, &c);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!pool_) pool_ = std::make_unique<ThreadPool>(threads_);
+  for (std::int64_t i = -radius; i <= radius; i++) {
+    for (std::int64_t j = -radius; j <= radius; j++) {
+      Key key{middle.row + i, middle.col + j};
+      if (cache_.count(key) || !pending_.insert(key).second) continue;
+      pool_->Submit([this, key] {
+        Insert(key, Generate(key));
+        std::lock_guard<std::mutex> done(mutex_);
+        pending_.erase(key);
+      });
+    }
+  }
+}
+
+void ChunkWorld::Wait() {
+  if (pool_) pool_->Wait();
+}
+
+std::vector<WorldPoint> ChunkWorld::GetPath(const WorldPoint& start,
+                                            const WorldPoint& end,
+                                            std::uint64_t limit) {
+  //  последний кусок держится отдельно, чтобы соседние клетки не ходили
+  //  в общий кэш
+  Key last_key{};
+  std::shared_ptr<const Chunk> last;
+  auto wall = [this, &last_key, &last](int part, std::int64_t row,
+                                       std::int64_t col) {
+    int r, c;
+    Key key = Locate(row, col, &r, &c);
+    if (!last || !(key == last_key)) {
+      last = GetChunk(key);
+      last_key = key;
+    }
+    return (part ? last->bottom : last->right)[r][c] != 0;
+  };
+  auto estimate = [&end](std::int64_t row, std::int64_t col) {
+    return Distance(row, end.row) + Distance(col, end.col);
+  };
+
+  struct Node {
+    Key parent;
+    std::uint64_t dist;
+  };
+  //  оценка, расстояние со знаком минус для выбора более глубоких клеток
+  //  при равной оценке, координаты
+  using Entry = std::tuple<std::uint64_t, std::int64_t, std::int64_t,
+                           std::int64_t>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+  std::unordered_map<Key, Node, KeyHash> nodes;
+  Key source{start.row, start.col}, target{end.row, end.col};
+  nodes[source] = {source, 0};
+  open.emplace(estimate(start.row, start.col), 0, start.row, start.col);
+  std::uint64_t expanded = 0;
+  bool found = false;
+  while (!open.empty() && expanded < limit) {
+    auto [f, minus_dist, row, col] = open.top();
+    open.pop();
+    std::uint64_t dist = -minus_dist;
+    Key cell{row, col};
+    if (nodes[cell].dist < dist) continue;
+    if (cell == target) {
+      found = true;
+      break;
+    }
+    expanded++;
+    Key neighbors[4];
+    int count = 0;
+    if (!wall(0, row, col)) neighbors[count++] = {row, col + 1};
+    if (!wall(0, row, col - 1)) neighbors[count++] = {row, col - 1};
+    if (!wall(1, row - 1, col)) neighbors[count++] = {row - 1, col};
+    if (!wall(1, row, col)) neighbors[count++] = {row + 1, col};
+    for (int i = 0; i < count; i++) {
+      auto [it, fresh] = nodes.try_emplace(neighbors[i], Node{cell, dist + 1});
+      if (!fresh) {
+        if (it->second.dist <= dist + 1) continue;
+        it->second = {cell, dist + 1};
+      }
+      open.emplace(dist + 1 + estimate(neighbors[i].row, neighbors[i].col),
+                   -static_cast<std::int64_t>(dist + 1), neighbors[i].row,
+                   neighbors[i].col);
+    }
+  }
+
+  std::vector<WorldPoint> path;
+  if (!found) return path;
+  for (Key cell = target;; cell = nodes[cell].parent) {
+    path.push_back({cell.row, cell.col});
+    if (cell == source) break;
+  }
+  return path;
+}
+
+std::size_t ChunkWorld::GetCachedChunks() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return cache_.size();
+}
+
+std::shared_ptr<const ChunkWorld::Chunk> ChunkWorld::GetChunk(const Key& key) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = cache_.find(key);
+    if (found != cache_.end()) {
+      order_.splice(order_.begin(), order_, found->second.order);
+      hits_++;
+      return found->second.chunk;
+    }
+  }
+  //  кусок, который сейчас генерируется в фоне, проще получить еще раз:
+  //  генерация детерминирована
+  std::shared_ptr<const Chunk> chunk = Generate(key);
+  Insert(key, chunk);
+  return chunk;
+}
+
+std::shared_ptr<const ChunkWorld::Chunk> ChunkWorld::Generate(const Key& key) {
+  auto chunk = std::make_shared<Chunk>();
+  EllerGenerator generator(Mix(seed_, key.row, key.col, kMaze));
+  generator.Generate(chunk_, chunk_, &chunk->right, &chunk->bottom);
+  //  Эллер не ставит стены снизу последней строки, границы закрываются
+  //  явно, и в каждой открывается один проход
+  WallRow& last = chunk->bottom[chunk_ - 1];
+  std::fill(last.begin(), last.end(), 1);
+  for (auto& row : chunk->right) row[chunk_ - 1] = 1;
+  chunk->right[Opening(key, 0)][chunk_ - 1] = 0;
+  chunk->bottom[chunk_ - 1][Opening(key, 1)] = 0;
+  generated_++;
+  return chunk;
+}
+
+int ChunkWorld::Opening(const Key& key, int side) const {
+  return Mix(seed_, key.row, key.col, side ? kBottomOpening : kRightOpening) %
+         chunk_;
+}
+
+ChunkWorld::Key ChunkWorld::Locate(std::int64_t row, std::int64_t col,
+                                   int* local_row, int* local_col) const {
+  Key key{FloorDiv(row, chunk_), FloorDiv(col, chunk_)};
+  *local_row = static_cast<int>(row - key.row * chunk_);
+  *local_col = static_cast<int>(col - key.col * chunk_);
+  return key;
+}
+
+void ChunkWorld::Insert(const Key& key, std::shared_ptr<const Chunk> chunk) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (cache_.count(key)) return;
+  order_.push_front(key);
+  cache_[key] = {std::move(chunk), order_.begin()};
+  while (cache_.size() > capacity_) {
+    cache_.erase(order_.back());
+    order_.pop_back();
+  }
+}
+
+}  // namespace s21
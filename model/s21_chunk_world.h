@@ -0,0 +1,198 @@
+#ifndef SRC_MODEL_S21_CHUNK_WORLD_H_
+#define SRC_MODEL_S21_CHUNK_WORLD_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "s21_memory.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+/**
+ * Координаты клетки бесконечного лабиринта
+ */
+struct WorldPoint {
+  std::int64_t row = 0;
+  std::int64_t col = 0;
+};
+
+/**
+ * Бесконечный лабиринт из квадратных кусков. Кусок генерируется алгоритмом
+ * Эллера с зерном из его координат, поэтому при повторной генерации
+ * получается тот же кусок. Кусок владеет своими стенами справа и снизу, в
+ * каждой такой границе один проход, положение которого тоже считается по
+ * координатам границы, так что соседи знают о проходах друг друга без
+ * генерации. Куски хранятся в кэше с вытеснением давно не нужных и могут
+ * генерироваться заранее в фоновых потоках
+ */
+class ChunkWorld {
+ public:
+  /**
+   * Сторона куска по умолчанию
+   */
+  static constexpr int kDefaultChunk = 64;
+  /**
+   * Число кусков в памяти по умолчанию
+   */
+  static constexpr std::size_t kDefaultCacheChunks = 256;
+  /**
+   * Наибольшее число клеток, просматриваемых поиском пути по умолчанию
+   */
+  static constexpr std::uint64_t kDefaultSearchLimit = std::uint64_t{1} << 22;
+
+  /**
+   * Конструктор
+   * @param seed - зерно мира
+   * @param chunk - сторона куска в клетках, не меньше 2
+   * @param cache_chunks - наибольшее число кусков в памяти
+   * @param threads - число фоновых потоков, 0 - по числу ядер
+   */
+  explicit ChunkWorld(std::uint64_t seed, int chunk = kDefaultChunk,
+                      std::size_t cache_chunks = kDefaultCacheChunks,
+                      int threads = 0);
+  /**
+   * Деструктор, дожидается фоновой генерации
+   */
+  ~ChunkWorld();
+  ChunkWorld(const ChunkWorld&) = delete;
+  ChunkWorld& operator=(const ChunkWorld&) = delete;
+
+  /**
+   * Метод получения зерна мира
+   */
+  std::uint64_t GetSeed() const { return seed_; }
+  /**
+   * Метод получения стороны куска
+   */
+  int GetChunkSize() const { return chunk_; }
+  /**
+   * Метод проверки стены справа от клетки
+   */
+  bool HasRightWall(std::int64_t row, std::int64_t col);
+  /**
+   * Метод проверки стены снизу от клетки
+   */
+  bool HasBottomWall(std::int64_t row, std::int64_t col);
+  /**
+   * Метод копирования прямоугольника мира в матрицы стен. Внешние стены
+   * прямоугольника закрываются
+   * @param top - строка верхнего левого угла
+   * @param left - столбец верхнего левого угла
+   * @param rows - число строк
+   * @param cols - число столбцов
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   */
+  void CopyWindow(std::int64_t top, std::int64_t left, int rows, int cols,
+                  WallMatrix* right, WallMatrix* bottom);
+  /**
+   * Метод фоновой генерации кусков вокруг клетки. Возвращается сразу
+   * @param center - клетка
+   * @param radius - число кусков в каждую сторону от куска клетки
+   */
+  void Prefetch(const WorldPoint& center, int radius);
+  /**
+   * Метод ожидания фоновой генерации
+   */
+  void Wait();
+  /**
+   * Метод поиска кратчайшего пути A*. Куски генерируются по мере того,
+   * как до них доходит поиск
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @param limit - наибольшее число просмотренных клеток
+   * @return - путь от конечной точки к начальной или пустой путь, если
+   * предел исчерпан
+   */
+  std::vector<WorldPoint> GetPath(const WorldPoint& start,
+                                  const WorldPoint& end,
+                                  std::uint64_t limit = kDefaultSearchLimit);
+  /**
+   * Метод получения числа сгенерированных кусков, включая повторные
+   */
+  std::uint64_t GetGenerated() const { return generated_; }
+  /**
+   * Метод получения числа обращений к кускам, уже бывшим в памяти
+   */
+  std::uint64_t GetHits() const { return hits_; }
+  /**
+   * Метод получения числа кусков в памяти
+   */
+  std::size_t GetCachedChunks();
+
+ protected:
+  /**
+   * Кусок мира: стены справа и снизу его клеток
+   */
+  struct Chunk {
+    WallMatrix right;
+    WallMatrix bottom;
+  };
+  /**
+   * Координаты куска
+   */
+  struct Key {
+    std::int64_t row;
+    std::int64_t col;
+    bool operator==(const Key& other) const {
+      return row == other.row && col == other.col;
+    }
+  };
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  /**
+   * Метод получения куска, при отсутствии в памяти кусок генерируется
+   * @param key - координаты куска
+   */
+  std::shared_ptr<const Chunk> GetChunk(const Key& key);
+  /**
+   * Метод генерации куска
+   * @param key - координаты куска
+   */
+  std::shared_ptr<const Chunk> Generate(const Key& key);
+  /**
+   * Метод получения положения прохода в границе куска
+   * @param key - координаты куска
+   * @param side - 0 для границы справа, 1 для границы снизу
+   * @return - номер строки или столбца клетки с проходом
+   */
+  int Opening(const Key& key, int side) const;
+  /**
+   * Метод получения куска клетки и ее координат внутри куска
+   */
+  Key Locate(std::int64_t row, std::int64_t col, int* local_row,
+             int* local_col) const;
+
+ private:
+  struct Slot {
+    std::shared_ptr<const Chunk> chunk;
+    std::list<Key>::iterator order;
+  };
+
+  void Insert(const Key& key, std::shared_ptr<const Chunk> chunk);
+
+  std::uint64_t seed_;
+  int chunk_;
+  std::size_t capacity_;
+  int threads_;
+  std::unique_ptr<ThreadPool> pool_;
+  std::mutex mutex_;
+  std::list<Key> order_;
+  std::unordered_map<Key, Slot, KeyHash> cache_;
+  std::unordered_set<Key, KeyHash> pending_;
+  std::atomic<std::uint64_t> generated_{0};
+  std::atomic<std::uint64_t> hits_{0};
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_CHUNK_WORLD_H_
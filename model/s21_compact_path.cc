@@ -0,0 +1,195 @@
+#include "s21_compact_path.h"
+
+#include <stdexcept>
+
+namespace s21 {
+
+namespace {
+
+CompactPath::Move Reverse(CompactPath::Move move) {
+  //  направления идут парами: вправо-влево, вверх-вниз
+  return static_cast<CompactPath::Move>(static_cast<unsigned>(move) ^ 1);
+}
+
+//  число символов экранирования с повтором count ходов
+std::size_t EscapeSymbols(std::size_t count) {
+  std::size_t symbols = 1;
+  do {
+    symbols += 2;
+    count >>= 3;
+  } while (count);
+  return symbols;
+}
+
+}  // namespace
+
+CompactPath CompactPath::Encode(const std::vector<Point>& path) {
+  CompactPath result;
+  if (path.empty()) return result;
+  result.start_ = path[0];
+  result.size_ = path.size();
+
+  Move run_move = Move::kRight, prev = Move::kRight;
+  bool has_prev = false;
+  std::size_t run_length = 0;
+  for (std::size_t i = 1; i < path.size(); i++) {
+    int dr = path[i].row - path[i - 1].row;
+    int dc = path[i].col - path[i - 1].col;
+    Move move;
+    if (dr == 0 && dc == 1) {
+      move = Move::kRight;
+    } else if (dr == 0 && dc == -1) {
+      move = Move::kLeft;
+    } else if (dr == -1 && dc == 0) {
+      move = Move::kUp;
+    } else if (dr == 1 && dc == 0) {
+      move = Move::kDown;
+    } else {
+      throw std::invalid_argument("Точки пути должны быть соседними.");
+    }
+    if (run_length > 0 && move != run_move) {
+      result.AppendRun(run_move, run_length, has_prev, prev);
+      prev = run_move;
+      has_prev = true;
+      run_length = 0;
+    }
+    run_move = move;
+    run_length++;
+  }
+  if (run_length > 0) result.AppendRun(run_move, run_length, has_prev, prev);
+  return result;
+}
+
+std::vector<Point> CompactPath::Decode() const {
+  return std::vector<Point>(begin(), end());
+}
+
+void CompactPath::Put(unsigned symbol) {
+  if (symbols_ % 4 == 0) data_.push_back(0);
+  data_.back() |= symbol << (symbols_ % 4 * 2);
+  symbols_++;
+}
+
+unsigned CompactPath::Get(std::size_t index) const {
+  return (data_[index / 4] >> (index % 4 * 2)) & 3;
+}
+
+//  группа - 3 бита числа и флаг продолжения, младшие биты идут первыми
+void CompactPath::PutCount(std::size_t count) {
+  do {
+    unsigned group = (count & 7) | (count > 7 ? 8 : 0);
+    Put(group & 3);
+    Put(group >> 2);
+    count >>= 3;
+  } while (count);
+}
+
+void CompactPath::AppendRun(Move move, std::size_t length, bool has_prev,
+                            Move prev) {
+  Put(static_cast<unsigned>(move));
+  //  код разворота совпадает с экранированием, поэтому за ним идет 0
+  if (has_prev && move == Reverse(prev)) PutCount(0);
+  //  остаток участка ходами или повтором, смотря что короче
+  std::size_t rest = length - 1;
+  if (rest > 0 && EscapeSymbols(rest) < rest) {
+    Put(static_cast<unsigned>(Reverse(move)));
+    PutCount(rest);
+  } else {
+    for (std::size_t i = 0; i < rest; i++) Put(static_cast<unsigned>(move));
+  }
+}
+
+std::size_t CompactPath::ReadToken(std::size_t offset, bool has_prev,
+                                   Move prev, Move* move,
+                                   std::size_t* count) const {
+  Move symbol = static_cast<Move>(Get(offset++));
+  if (!has_prev || symbol != Reverse(prev)) {
+    *move = symbol;
+    *count = 1;
+    return offset;
+  }
+  std::size_t value = 0;
+  for (int shift = 0;; shift += 3) {
+    unsigned group = Get(offset) | Get(offset + 1) << 2;
+    offset += 2;
+    value |= static_cast<std::size_t>(group & 7) << shift;
+    if (!(group & 8)) break;
+  }
+  *move = value ? prev : symbol;
+  *count = value ? value : 1;
+  return offset;
+}
+
+std::size_t CompactPath::ReadRun(std::size_t offset, Move* move,
+                                 std::size_t* length) const {
+  offset = ReadToken(offset, offset > 0, *move, move, length);
+  //  участок продолжается одинаковыми ходами и повторами
+  while (offset < symbols_) {
+    Move next;
+    std::size_t count;
+    std::size_t end = ReadToken(offset, true, *move, &next, &count);
+    if (next != *move) break;
+    *length += count;
+    offset = end;
+  }
+  return offset;
+}
+
+Point CompactPath::Step(const Point& point, Move move, std::size_t length) {
+  int steps = static_cast<int>(length);
+  switch (move) {
+    case Move::kRight:
+      return Point(point.row, point.col + steps);
+    case Move::kLeft:
+      return Point(point.row, point.col - steps);
+    case Move::kUp:
+      return Point(point.row - steps, point.col);
+    default:
+      return Point(point.row + steps, point.col);
+  }
+}
+
+CompactPath::PointIterator::PointIterator(const CompactPath* path,
+                                          std::size_t index)
+    : path_(path), index_(index) {
+  if (index_ < path_->size_) point_ = path_->start_;
+}
+
+CompactPath::PointIterator& CompactPath::PointIterator::operator++() {
+  if (++index_ >= path_->size_) return *this;
+  if (left_ == 0) offset_ = path_->ReadRun(offset_, &move_, &left_);
+  point_ = Step(point_, move_, 1);
+  left_--;
+  return *this;
+}
+
+CompactPath::PointIterator CompactPath::PointIterator::operator++(int) {
+  PointIterator copy = *this;
+  ++*this;
+  return copy;
+}
+
+CompactPath::RunIterator::RunIterator(const CompactPath* path,
+                                      std::size_t offset)
+    : path_(path), offset_(offset) {
+  if (offset_ < path_->symbols_) {
+    run_.from = path_->start_;
+    Decode();
+  }
+}
+
+void CompactPath::RunIterator::Decode() {
+  next_ = path_->ReadRun(offset_, &run_.move, &run_.length);
+  run_.to = Step(run_.from, run_.move, run_.length);
+}
+
+CompactPath::RunIterator& CompactPath::RunIterator::operator++() {
+  offset_ = next_;
+  if (offset_ < path_->symbols_) {
+    run_.from = run_.to;
+    Decode();
+  }
+  return *this;
+}
+
+}  // namespace s21
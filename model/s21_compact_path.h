@@ -0,0 +1,183 @@
+#ifndef SRC_MODEL_S21_COMPACT_PATH_H_
+#define SRC_MODEL_S21_COMPACT_PATH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "s21_point.h"
+
+namespace s21 {
+
+/**
+ * Компактный путь: начальная точка и поток ходов по 2 бита, четыре хода в
+ * байте. Кратчайший путь не разворачивается назад, поэтому код хода,
+ * обратного предыдущему, служит экранированием: за ним следует число в
+ * группах по 3 бита с флагом продолжения. Число N > 0 повторяет
+ * предыдущий ход еще N раз и кодирует прямые участки длиннее 4 клеток, 0
+ * означает настоящий разворот. Путь без разворотов занимает не больше 2
+ * бит на ход
+ */
+class CompactPath {
+ public:
+  /**
+   * Направление хода
+   */
+  enum class Move : std::uint8_t { kRight, kLeft, kUp, kDown };
+
+  /**
+   * Прямой участок пути
+   */
+  struct Run {
+    /**
+     * Первая точка участка
+     */
+    Point from;
+    /**
+     * Последняя точка участка
+     */
+    Point to;
+    /**
+     * Направление ходов
+     */
+    Move move;
+    /**
+     * Число ходов
+     */
+    std::size_t length;
+  };
+
+  /**
+   * Итератор по точкам пути, точки декодируются по одной
+   */
+  class PointIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Point;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Point*;
+    using reference = const Point&;
+
+    PointIterator(const CompactPath* path, std::size_t index);
+    reference operator*() const { return point_; }
+    pointer operator->() const { return &point_; }
+    PointIterator& operator++();
+    PointIterator operator++(int);
+    bool operator==(const PointIterator& other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const PointIterator& other) const {
+      return index_ != other.index_;
+    }
+
+   private:
+    const CompactPath* path_;
+    std::size_t index_;
+    std::size_t offset_ = 0;
+    std::size_t left_ = 0;
+    Move move_ = Move::kRight;
+    Point point_;
+  };
+
+  /**
+   * Итератор по прямым участкам пути
+   */
+  class RunIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Run;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Run*;
+    using reference = const Run&;
+
+    RunIterator(const CompactPath* path, std::size_t offset);
+    reference operator*() const { return run_; }
+    pointer operator->() const { return &run_; }
+    RunIterator& operator++();
+    bool operator==(const RunIterator& other) const {
+      return offset_ == other.offset_;
+    }
+    bool operator!=(const RunIterator& other) const {
+      return offset_ != other.offset_;
+    }
+
+   private:
+    void Decode();
+
+    const CompactPath* path_;
+    std::size_t offset_;
+    std::size_t next_ = 0;
+    Run run_;
+  };
+
+  /**
+   * Диапазон прямых участков для цикла range-for
+   */
+  struct Runs {
+    const CompactPath* path;
+    RunIterator begin() const { return path->RunsBegin(); }
+    RunIterator end() const { return path->RunsEnd(); }
+  };
+
+  /**
+   * Метод кодирования пути из соседних по стороне точек
+   * @param path - путь в формате Model::GetPath
+   * @return - компактный путь
+   */
+  static CompactPath Encode(const std::vector<Point>& path);
+  /**
+   * Метод декодирования всех точек пути
+   */
+  std::vector<Point> Decode() const;
+  /**
+   * Метод получения числа точек пути
+   */
+  std::size_t Size() const { return size_; }
+  /**
+   * Метод проверки пустоты пути
+   */
+  bool Empty() const { return size_ == 0; }
+  /**
+   * Метод получения числа байтов закодированных ходов
+   */
+  std::size_t Bytes() const { return data_.size(); }
+  /**
+   * Метод получения числа 2-битных символов закодированных ходов
+   */
+  std::size_t Symbols() const { return symbols_; }
+  /**
+   * Метод получения первой точки пути
+   */
+  const Point& Front() const { return start_; }
+
+  PointIterator begin() const { return PointIterator(this, 0); }
+  PointIterator end() const { return PointIterator(this, size_); }
+  /**
+   * Метод получения прямых участков пути
+   */
+  Runs GetRuns() const { return Runs{this}; }
+  RunIterator RunsBegin() const { return RunIterator(this, 0); }
+  RunIterator RunsEnd() const { return RunIterator(this, symbols_); }
+
+ private:
+  void Put(unsigned symbol);
+  unsigned Get(std::size_t index) const;
+  void PutCount(std::size_t count);
+  void AppendRun(Move move, std::size_t length, bool has_prev, Move prev);
+  //  читает ход или экранирование, offset и результат - номера символов
+  std::size_t ReadToken(std::size_t offset, bool has_prev, Move prev,
+                        Move* move, std::size_t* count) const;
+  //  читает прямой участок, в move передается ход предыдущего участка
+  std::size_t ReadRun(std::size_t offset, Move* move,
+                      std::size_t* length) const;
+  static Point Step(const Point& point, Move move, std::size_t length);
+
+  Point start_;
+  std::size_t size_ = 0;
+  std::size_t symbols_ = 0;
+  std::vector<std::uint8_t> data_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_COMPACT_PATH_H_
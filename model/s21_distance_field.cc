@@ -0,0 +1,198 @@
+#include "s21_distance_field.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+
+namespace s21 {
+
+namespace {
+
+//  отметки клеток при починке поля
+constexpr char kNone = 0;
+constexpr char kSupported = 1;
+constexpr char kAffected = 2;
+
+}  // namespace
+
+void DistanceField::Build(const WallMatrix& right, const WallMatrix& bottom,
+                          const Point& source) {
+  rows_ = right.size();
+  cols_ = rows_ ? right[0].size() : 0;
+  source_ = source;
+  dist_.assign(rows_ * cols_, kUnreachable);
+  mark_.clear();
+  touched_.clear();
+
+  queue_.clear();
+  queue_.reserve(rows_ * cols_);
+  int start = source.row * cols_ + source.col;
+  dist_[start] = 0;
+  queue_.push_back(start);
+  int neighbors[4];
+  for (std::size_t head = 0; head < queue_.size(); head++) {
+    int cell = queue_[head];
+    for (int i = 0, n = Neighbors(right, bottom, cell, neighbors); i < n; i++) {
+      if (dist_[neighbors[i]] == kUnreachable) {
+        dist_[neighbors[i]] = dist_[cell] + 1;
+        queue_.push_back(neighbors[i]);
+      }
+    }
+  }
+}
+
+void DistanceField::Clear() {
+  dist_.clear();
+  mark_.clear();
+  touched_.clear();
+  rows_ = 0;
+  cols_ = 0;
+}
+
+int DistanceField::GetDistance(const Point& point) const {
+  return dist_[point.row * cols_ + point.col];
+}
+
+int DistanceField::Neighbors(const WallMatrix& right,
+                             const WallMatrix& bottom,
+                             int cell, int (&neighbors)[4]) const {
+  int row = cell / cols_, col = cell % cols_, count = 0;
+  if (col < cols_ - 1 && !right[row][col]) neighbors[count++] = cell + 1;
+  if (col > 0 && !right[row][col - 1]) neighbors[count++] = cell - 1;
+  if (row > 0 && !bottom[row - 1][col]) neighbors[count++] = cell - cols_;
+  if (row < rows_ - 1 && !bottom[row][col]) neighbors[count++] = cell + cols_;
+  return count;
+}
+
+void DistanceField::Update(const WallMatrix& right, const WallMatrix& bottom,
+                           const Point& a, const Point& b) {
+  touched_.clear();
+  mark_.resize(dist_.size(), kNone);
+  int u = a.row * cols_ + a.col, v = b.row * cols_ + b.col;
+  //  u - клетка ближе к исходной, недостижимые считаются бесконечно далекими
+  if (dist_[u] == kUnreachable ||
+      (dist_[v] != kUnreachable && dist_[v] < dist_[u])) {
+    std::swap(u, v);
+  }
+  if (dist_[u] == kUnreachable) return;
+
+  bool open = a.row == b.row ? !right[a.row][std::min(a.col, b.col)]
+                             : !bottom[std::min(a.row, b.row)][a.col];
+  if (open && (dist_[v] == kUnreachable || dist_[v] > dist_[u] + 1)) {
+    dist_[v] = dist_[u] + 1;
+    Decrease(right, bottom, v);
+  } else if (!open && dist_[v] == dist_[u] + 1) {
+    Increase(right, bottom, v);
+  }
+}
+
+void DistanceField::Decrease(const WallMatrix& right, const WallMatrix& bottom,
+                             int cell) {
+  touched_.push_back(cell);
+  int neighbors[4];
+  for (std::size_t head = 0; head < touched_.size(); head++) {
+    int current = touched_[head];
+    for (int i = 0, n = Neighbors(right, bottom, current, neighbors); i < n;
+         i++) {
+      int& next = dist_[neighbors[i]];
+      if (next == kUnreachable || next > dist_[current] + 1) {
+        next = dist_[current] + 1;
+        touched_.push_back(neighbors[i]);
+      }
+    }
+  }
+}
+
+void DistanceField::Increase(const WallMatrix& right, const WallMatrix& bottom,
+                             int cell) {
+  //  поиск клеток, у которых не осталось соседа на расстоянии на 1 меньше;
+  //  очередь идет по возрастанию расстояния, поэтому предки решены раньше
+  int neighbors[4];
+  std::vector<int> affected;
+  touched_.push_back(cell);
+  mark_[cell] = kSupported;
+  for (std::size_t head = 0; head < touched_.size(); head++) {
+    int current = touched_[head];
+    bool supported = false;
+    int n = Neighbors(right, bottom, current, neighbors);
+    for (int i = 0; i < n && !supported; i++) {
+      supported = dist_[neighbors[i]] == dist_[current] - 1 &&
+                  mark_[neighbors[i]] != kAffected;
+    }
+    if (supported) continue;
+    mark_[current] = kAffected;
+    affected.push_back(current);
+    for (int i = 0; i < n; i++) {
+      if (dist_[neighbors[i]] == dist_[current] + 1 &&
+          mark_[neighbors[i]] == kNone) {
+        mark_[neighbors[i]] = kSupported;
+        touched_.push_back(neighbors[i]);
+      }
+    }
+  }
+
+  //  пересчет затронутых клеток от их незатронутой границы
+  using Item = std::pair<int, int>;
+  std::priority_queue<Item, std::vector<Item>, std::greater<Item>> queue;
+  for (int current : affected) {
+    int best = kUnreachable;
+    for (int i = 0, n = Neighbors(right, bottom, current, neighbors); i < n;
+         i++) {
+      int d = dist_[neighbors[i]];
+      if (mark_[neighbors[i]] != kAffected && d != kUnreachable &&
+          (best == kUnreachable || d + 1 < best)) {
+        best = d + 1;
+      }
+    }
+    dist_[current] = kUnreachable;
+    if (best != kUnreachable) queue.push({best, current});
+  }
+  while (!queue.empty()) {
+    auto [d, current] = queue.top();
+    queue.pop();
+    if (dist_[current] != kUnreachable && dist_[current] <= d) continue;
+    dist_[current] = d;
+    for (int i = 0, n = Neighbors(right, bottom, current, neighbors); i < n;
+         i++) {
+      int next = neighbors[i];
+      if (mark_[next] == kAffected &&
+          (dist_[next] == kUnreachable || dist_[next] > d + 1)) {
+        queue.push({d + 1, next});
+      }
+    }
+  }
+  for (int current : touched_) mark_[current] = kNone;
+}
+
+std::vector<Point> DistanceField::GetPath(const WallMatrix& right,
+                                          const WallMatrix& bottom,
+                                          const Point& end) const {
+  std::vector<Point> path;
+  AppendPath(right, bottom, end, &path);
+  return path;
+}
+
+std::size_t DistanceField::AppendPath(const WallMatrix& right,
+                                      const WallMatrix& bottom,
+                                      const Point& end,
+                                      std::vector<Point>* path) const {
+  int cell = end.row * cols_ + end.col;
+  if (dist_[cell] == kUnreachable) return 0;
+  path->reserve(path->size() + dist_[cell] + 1);
+  path->push_back(end);
+  int neighbors[4];
+  while (dist_[cell] != 0) {
+    int n = Neighbors(right, bottom, cell, neighbors);
+    for (int i = 0; i < n; i++) {
+      if (dist_[neighbors[i]] == dist_[cell] - 1) {
+        cell = neighbors[i];
+        break;
+      }
+    }
+    path->push_back({cell / cols_, cell % cols_});
+  }
+  return dist_[end.row * cols_ + end.col] + 1;
+}
+
+}  // namespace s21
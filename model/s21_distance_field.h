@@ -0,0 +1,114 @@
+#ifndef SRC_MODEL_S21_DISTANCE_FIELD_H_
+#define SRC_MODEL_S21_DISTANCE_FIELD_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "s21_memory.h"
+#include "s21_point.h"
+
+namespace s21 {
+
+/**
+ * Поле расстояний от одной клетки до всех остальных. После изменения
+ * одной стены поле чинится только в затронутой области
+ */
+class DistanceField {
+ public:
+  /**
+   * Расстояние до недостижимой клетки
+   */
+  static constexpr int kUnreachable = -1;
+
+  /**
+   * Метод построения поля обходом в ширину
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param source - клетка, от которой считаются расстояния
+   */
+  void Build(const WallMatrix& right, const WallMatrix& bottom,
+             const Point& source);
+  /**
+   * Метод сброса поля
+   */
+  void Clear();
+  /**
+   * Метод проверки, построено ли поле
+   */
+  bool IsValid() const { return !dist_.empty(); }
+  /**
+   * Метод получения клетки, от которой считаются расстояния
+   */
+  const Point& GetSource() const { return source_; }
+  /**
+   * Метод получения расстояния до клетки
+   * @param point - координаты клетки
+   * @return - расстояние или kUnreachable
+   */
+  int GetDistance(const Point& point) const;
+  /**
+   * Метод починки поля после изменения стены между соседними клетками.
+   * Стена в матрицах уже должна быть изменена
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param a - первая клетка
+   * @param b - соседняя с ней клетка
+   */
+  void Update(const WallMatrix& right, const WallMatrix& bottom, const Point& a,
+              const Point& b);
+  /**
+   * Метод получения числа клеток, просмотренных последней починкой
+   */
+  std::size_t GetTouched() const { return touched_.size(); }
+  /**
+   * Метод восстановления пути по полю в формате Model::GetPath
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param end - конечная клетка
+   * @return - путь от конечной клетки к исходной
+   */
+  std::vector<Point> GetPath(const WallMatrix& right, const WallMatrix& bottom,
+                             const Point& end) const;
+  /**
+   * Метод дописывания пути к концу буфера
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param end - конечная клетка
+   * @param path - буфер точек
+   * @return - длина дописанного пути, 0 если пути нет
+   */
+  std::size_t AppendPath(const WallMatrix& right, const WallMatrix& bottom,
+                         const Point& end, std::vector<Point>* path) const;
+
+ protected:
+  /**
+   * Метод получения соседей клетки без стены между ними в порядке
+   * вправо, влево, вверх, вниз
+   * @param cell - номер клетки
+   * @param neighbors - номера соседей
+   * @return - число соседей
+   */
+  int Neighbors(const WallMatrix& right,
+                const WallMatrix& bottom, int cell,
+                int (&neighbors)[4]) const;
+  /**
+   * Метод распространения уменьшения расстояния от клетки
+   */
+  void Decrease(const WallMatrix& right, const WallMatrix& bottom, int cell);
+  /**
+   * Метод пересчета клеток, потерявших кратчайший путь через стену
+   */
+  void Increase(const WallMatrix& right, const WallMatrix& bottom, int cell);
+
+ private:
+  int rows_ = 0;
+  int cols_ = 0;
+  Point source_;
+  std::vector<int> dist_;
+  std::vector<char> mark_;
+  std::vector<int> touched_;
+  std::vector<int> queue_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_DISTANCE_FIELD_H_
@@ -0,0 +1,45 @@
+#include "s21_fixed_maze.h"
+
+namespace s21 {
+
+namespace {
+
+//  выбор специализации по числу столбцов при известном числе строк
+template <std::size_t R>
+std::unique_ptr<FixedMazeBase> MakeWithCols(int rows, int cols) {
+  switch ((cols + kFixedMazeStep - 1) / kFixedMazeStep) {
+    case 1:
+      return std::make_unique<FixedMazeEngine<R, 10>>(rows, cols);
+    case 2:
+      return std::make_unique<FixedMazeEngine<R, 20>>(rows, cols);
+    case 3:
+      return std::make_unique<FixedMazeEngine<R, 30>>(rows, cols);
+    case 4:
+      return std::make_unique<FixedMazeEngine<R, 40>>(rows, cols);
+    default:
+      return std::make_unique<FixedMazeEngine<R, 50>>(rows, cols);
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<FixedMazeBase> MakeFixedMaze(int rows, int cols) {
+  if (rows <= 0 || cols <= 0 || rows > kFixedMazeMaxSize ||
+      cols > kFixedMazeMaxSize) {
+    return nullptr;
+  }
+  switch ((rows + kFixedMazeStep - 1) / kFixedMazeStep) {
+    case 1:
+      return MakeWithCols<10>(rows, cols);
+    case 2:
+      return MakeWithCols<20>(rows, cols);
+    case 3:
+      return MakeWithCols<30>(rows, cols);
+    case 4:
+      return MakeWithCols<40>(rows, cols);
+    default:
+      return MakeWithCols<50>(rows, cols);
+  }
+}
+
+}  // namespace s21
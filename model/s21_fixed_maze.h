@@ -0,0 +1,367 @@
+#ifndef SRC_MODEL_S21_FIXED_MAZE_H_
+#define SRC_MODEL_S21_FIXED_MAZE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "s21_memory.h"
+#include "s21_point.h"
+
+namespace s21 {
+
+/**
+ * Максимальный размер лабиринта, для которого есть специализации FixedMaze
+ */
+constexpr int kFixedMazeMaxSize = 50;
+/**
+ * Шаг между размерами специализаций FixedMaze
+ */
+constexpr int kFixedMazeStep = 10;
+
+/**
+ * Генератор псевдослучайных чисел splitmix64, пригодный для constexpr
+ */
+class SplitMix64 {
+ public:
+  /**
+   * Конструктор
+   * @param seed - зерно генератора
+   */
+  constexpr explicit SplitMix64(std::uint64_t seed) : state_(seed) {}
+  /**
+   * Метод получения следующего 64-битного числа
+   */
+  constexpr std::uint64_t Next() {
+    std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+  /**
+   * Метод получения случайного бита, биты берутся из одного слова по очереди
+   */
+  constexpr int NextBit() {
+    if (bits_left_ == 0) {
+      bits_ = Next();
+      bits_left_ = 64;
+    }
+    int bit = static_cast<int>(bits_ & 1);
+    bits_ >>= 1;
+    bits_left_--;
+    return bit;
+  }
+
+ private:
+  std::uint64_t state_;
+  std::uint64_t bits_ = 0;
+  int bits_left_ = 0;
+};
+
+/**
+ * Лабиринт с размерами, известными на этапе компиляции. Стены хранятся
+ * битовыми строками в std::array: бит c слова r означает стену у клетки
+ * (r, c). Фактический размер (rows, cols) может быть меньше емкости R x C,
+ * тогда лабиринт занимает левый верхний угол.
+ */
+template <std::size_t R, std::size_t C>
+class FixedMaze {
+  static_assert(R > 0 && C > 0, "Размеры лабиринта должны быть больше нуля");
+  static_assert(C <= 64, "Строка лабиринта должна помещаться в 64 бита");
+  static_assert(R * C <= 0xFFFF, "Номер клетки должен помещаться в 16 бит");
+
+ public:
+  /**
+   * Тип номера клетки (row * C + col)
+   */
+  using Cell = std::uint16_t;
+  /**
+   * Тип битовой строки стен
+   */
+  using Row = std::uint64_t;
+
+  /**
+   * Конструктор
+   * @param rows - число строк, не больше R
+   * @param cols - число столбцов, не больше C
+   */
+  constexpr explicit FixedMaze(int rows = R, int cols = C)
+      : rows_(rows), cols_(cols) {}
+
+  /**
+   * Метод получения числа строк
+   */
+  constexpr int Rows() const { return rows_; }
+  /**
+   * Метод получения числа столбцов
+   */
+  constexpr int Cols() const { return cols_; }
+  /**
+   * Метод проверки стены справа от клетки
+   */
+  constexpr bool RightWall(int row, int col) const {
+    return (right_[row] >> col) & 1;
+  }
+  /**
+   * Метод проверки стены снизу от клетки
+   */
+  constexpr bool BottomWall(int row, int col) const {
+    return (bottom_[row] >> col) & 1;
+  }
+  /**
+   * Метод установки стены справа от клетки
+   */
+  constexpr void SetRightWall(int row, int col, bool wall) {
+    right_[row] = wall ? right_[row] | Bit(col) : right_[row] & ~Bit(col);
+  }
+  /**
+   * Метод установки стены снизу от клетки
+   */
+  constexpr void SetBottomWall(int row, int col, bool wall) {
+    bottom_[row] = wall ? bottom_[row] | Bit(col) : bottom_[row] & ~Bit(col);
+  }
+
+  /**
+   * Метод генерации идеального лабиринта алгоритмом Эллера из зерна
+   * @param seed - зерно генератора
+   */
+  constexpr void Generate(std::uint64_t seed) {
+    SplitMix64 rng(seed);
+    std::array<Cell, C> line{};
+    Cell count = 1;
+    for (int r = 0; r < rows_; r++) {
+      right_[r] = 0;
+      bottom_[r] = 0;
+      for (int c = 0; c < cols_; c++) {
+        if (line[c] == 0) line[c] = count++;
+      }
+      for (int c = 0; c < cols_ - 1; c++) {
+        if (rng.NextBit() || line[c] == line[c + 1]) {
+          right_[r] |= Bit(c);
+        } else {
+          Merge(&line, line[c + 1], line[c]);
+        }
+      }
+      right_[r] |= Bit(cols_ - 1);
+      if (r == rows_ - 1) break;
+      for (int c = 0; c < cols_; c++) {
+        if (rng.NextBit()) bottom_[r] |= Bit(c);
+      }
+      for (int c = 0; c < cols_; c++) {
+        bool has_exit = false;
+        for (int k = 0; k < cols_ && !has_exit; k++) {
+          has_exit = line[k] == line[c] && !BottomWall(r, k);
+        }
+        if (!has_exit) bottom_[r] &= ~Bit(c);
+      }
+      for (int c = 0; c < cols_; c++) {
+        if (BottomWall(r, c)) line[c] = 0;
+      }
+    }
+    for (int c = 0; c < cols_ - 1; c++) {
+      if (line[c] != line[c + 1]) {
+        right_[rows_ - 1] &= ~Bit(c);
+        Merge(&line, line[c + 1], line[c]);
+      }
+    }
+    UpdateMoves();
+  }
+
+  /**
+   * Метод поиска кратчайшего пути волновым алгоритмом
+   * @param start - номер начальной клетки
+   * @param end - номер конечной клетки
+   * @param path - путь от конечной клетки к начальной
+   * @return - длина пути, 0 если пути нет
+   */
+  constexpr std::size_t Solve(Cell start, Cell end,
+                              std::array<Cell, R * C>* path) const {
+    std::array<Cell, R * C> dist{};
+    std::array<Cell, R * C> queue{};
+    std::size_t head = 0, tail = 0;
+    dist[start] = 1;
+    queue[tail++] = start;
+    while (head < tail && dist[end] == 0) {
+      Cell cell = queue[head++];
+      int r = cell / C, c = cell % C;
+      Cell next = static_cast<Cell>(dist[cell] + 1);
+      if (((move_right_[r] >> c) & 1) && !dist[cell + 1]) {
+        dist[cell + 1] = next;
+        queue[tail++] = static_cast<Cell>(cell + 1);
+      }
+      if (((move_left_[r] >> c) & 1) && !dist[cell - 1]) {
+        dist[cell - 1] = next;
+        queue[tail++] = static_cast<Cell>(cell - 1);
+      }
+      if (((move_up_[r] >> c) & 1) && !dist[cell - C]) {
+        dist[cell - C] = next;
+        queue[tail++] = static_cast<Cell>(cell - C);
+      }
+      if (((move_down_[r] >> c) & 1) && !dist[cell + C]) {
+        dist[cell + C] = next;
+        queue[tail++] = static_cast<Cell>(cell + C);
+      }
+    }
+    if (dist[end] == 0) return 0;
+    std::size_t length = 0;
+    Cell cell = end;
+    (*path)[length++] = cell;
+    while (dist[cell] != 1) {
+      int r = cell / C, c = cell % C;
+      Cell prev = static_cast<Cell>(dist[cell] - 1);
+      if (((move_right_[r] >> c) & 1) && dist[cell + 1] == prev) {
+        cell = static_cast<Cell>(cell + 1);
+      } else if (((move_left_[r] >> c) & 1) && dist[cell - 1] == prev) {
+        cell = static_cast<Cell>(cell - 1);
+      } else if (((move_up_[r] >> c) & 1) && dist[cell - C] == prev) {
+        cell = static_cast<Cell>(cell - C);
+      } else {
+        cell = static_cast<Cell>(cell + C);
+      }
+      (*path)[length++] = cell;
+    }
+    return length;
+  }
+
+  /**
+   * Метод загрузки стен из матриц модели
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   */
+  void Load(const WallMatrix& right, const WallMatrix& bottom) {
+    for (int r = 0; r < rows_; r++) {
+      right_[r] = 0;
+      bottom_[r] = 0;
+      for (int c = 0; c < cols_; c++) {
+        if (right[r][c]) right_[r] |= Bit(c);
+        if (bottom[r][c]) bottom_[r] |= Bit(c);
+      }
+    }
+    UpdateMoves();
+  }
+  /**
+   * Метод выгрузки стен в матрицы модели
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   */
+  void Store(WallMatrix* right, WallMatrix* bottom) const {
+    right->assign(rows_, WallRow(cols_));
+    bottom->assign(rows_, WallRow(cols_));
+    for (int r = 0; r < rows_; r++) {
+      for (int c = 0; c < cols_; c++) {
+        (*right)[r][c] = RightWall(r, c);
+        (*bottom)[r][c] = BottomWall(r, c);
+      }
+    }
+  }
+  /**
+   * Метод поиска пути в формате Model::GetPath
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь от конечной точки к начальной
+   */
+  std::vector<Point> GetPath(const Point& start, const Point& end) const {
+    std::array<Cell, R * C> cells{};
+    std::size_t length = Solve(static_cast<Cell>(start.row * C + start.col),
+                               static_cast<Cell>(end.row * C + end.col),
+                               &cells);
+    std::vector<Point> path;
+    path.reserve(length);
+    for (std::size_t i = 0; i < length; i++) {
+      path.emplace_back(cells[i] / C, cells[i] % C);
+    }
+    return path;
+  }
+
+ private:
+  static constexpr Row Bit(int col) { return Row{1} << col; }
+
+  static constexpr void Merge(std::array<Cell, C>* line, Cell from, Cell to) {
+    for (auto& set : *line) {
+      if (set == from) set = to;
+    }
+  }
+
+  //  маски допустимых ходов: проверки границ заложены в сами маски
+  constexpr void UpdateMoves() {
+    Row inner = cols_ > 1 ? (Bit(cols_ - 1) - 1) : 0;
+    Row all = cols_ == 64 ? ~Row{0} : Bit(cols_) - 1;
+    for (int r = 0; r < rows_; r++) {
+      move_right_[r] = ~right_[r] & inner;
+      move_left_[r] = move_right_[r] << 1;
+      move_down_[r] = r < rows_ - 1 ? (~bottom_[r] & all) : 0;
+      move_up_[r] = r > 0 ? move_down_[r - 1] : 0;
+    }
+  }
+
+  int rows_;
+  int cols_;
+  std::array<Row, R> right_{};
+  std::array<Row, R> bottom_{};
+  std::array<Row, R> move_right_{};
+  std::array<Row, R> move_left_{};
+  std::array<Row, R> move_up_{};
+  std::array<Row, R> move_down_{};
+};
+
+/**
+ * Интерфейс для выбора специализации FixedMaze во время выполнения
+ */
+class FixedMazeBase {
+ public:
+  virtual ~FixedMazeBase() = default;
+  /**
+   * Метод генерации лабиринта из зерна
+   * @param seed - зерно генератора
+   */
+  virtual void Generate(std::uint64_t seed) = 0;
+  /**
+   * Метод загрузки стен из матриц модели
+   */
+  virtual void Load(const WallMatrix& right, const WallMatrix& bottom) = 0;
+  /**
+   * Метод выгрузки стен в матрицы модели
+   */
+  virtual void Store(WallMatrix* right, WallMatrix* bottom) const = 0;
+  /**
+   * Метод поиска пути в формате Model::GetPath
+   */
+  virtual std::vector<Point> GetPath(const Point& start,
+                                     const Point& end) const = 0;
+};
+
+/**
+ * Обертка над FixedMaze с виртуальным интерфейсом
+ */
+template <std::size_t R, std::size_t C>
+class FixedMazeEngine : public FixedMazeBase {
+ public:
+  FixedMazeEngine(int rows, int cols) : maze_(rows, cols) {}
+  void Generate(std::uint64_t seed) override { maze_.Generate(seed); }
+  void Load(const WallMatrix& right, const WallMatrix& bottom) override {
+    maze_.Load(right, bottom);
+  }
+  void Store(WallMatrix* right, WallMatrix* bottom) const override {
+    maze_.Store(right, bottom);
+  }
+  std::vector<Point> GetPath(const Point& start,
+                             const Point& end) const override {
+    return maze_.GetPath(start, end);
+  }
+
+ private:
+  FixedMaze<R, C> maze_;
+};
+
+/**
+ * Метод создания ближайшей специализации FixedMaze, вмещающей лабиринт
+ * @param rows - число строк
+ * @param cols - число столбцов
+ * @return - движок лабиринта или nullptr, если лабиринт слишком большой
+ */
+std::unique_ptr<FixedMazeBase> MakeFixedMaze(int rows, int cols);
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_FIXED_MAZE_H_
@@ -0,0 +1,324 @@
+#include "s21_generator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+namespace {
+
+//  все стены закрыты
+void FillWalls(int rows, int cols, WallMatrix* right, WallMatrix* bottom) {
+  right->assign(rows, WallRow(cols, 1));
+  bottom->assign(rows, WallRow(cols, 1));
+}
+
+//  удаление стены между соседними клетками a < b
+void Carve(int cols, int a, int b, WallMatrix* right, WallMatrix* bottom) {
+  if (a > b) std::swap(a, b);
+  if (b == a + cols) {
+    (*bottom)[a / cols][a % cols] = 0;
+  } else {
+    (*right)[a / cols][a % cols] = 0;
+  }
+}
+
+//  соседи клетки внутри лабиринта
+int Neighbors(int rows, int cols, int cell, int (&neighbors)[4]) {
+  int row = cell / cols, col = cell % cols, count = 0;
+  if (col < cols - 1) neighbors[count++] = cell + 1;
+  if (col > 0) neighbors[count++] = cell - 1;
+  if (row > 0) neighbors[count++] = cell - cols;
+  if (row < rows - 1) neighbors[count++] = cell + cols;
+  return count;
+}
+
+}  // namespace
+
+const char* GeneratorName(GeneratorKind kind) {
+  switch (kind) {
+    case GeneratorKind::kEller:
+      return "eller";
+    case GeneratorKind::kKruskal:
+      return "kruskal";
+    case GeneratorKind::kWilson:
+      return "wilson";
+    case GeneratorKind::kBacktracker:
+      return "backtracker";
+    case GeneratorKind::kSidewinder:
+      return "sidewinder";
+    case GeneratorKind::kBinaryTree:
+      return "binary-tree";
+  }
+  return "";
+}
+
+GeneratorKind GeneratorFromName(const std::string& name) {
+  for (GeneratorKind kind : kGeneratorKinds) {
+    if (name == GeneratorName(kind)) return kind;
+  }
+  throw std::invalid_argument("Неизвестный алгоритм генерации: " + name);
+}
+
+std::unique_ptr<MazeGenerator> MakeGenerator(GeneratorKind kind,
+                                             std::uint64_t seed) {
+  switch (kind) {
+    case GeneratorKind::kKruskal:
+      return std::make_unique<KruskalGenerator>(seed);
+    case GeneratorKind::kWilson:
+      return std::make_unique<WilsonGenerator>(seed);
+    case GeneratorKind::kBacktracker:
+      return std::make_unique<BacktrackerGenerator>(seed);
+    case GeneratorKind::kSidewinder:
+      return std::make_unique<SidewinderGenerator>(seed);
+    case GeneratorKind::kBinaryTree:
+      return std::make_unique<BinaryTreeGenerator>(seed);
+    default:
+      return std::make_unique<EllerGenerator>(seed);
+  }
+}
+
+//  генерация лабиринта
+void EllerGenerator::Generate(int rows, int cols, WallMatrix* right,
+                              WallMatrix* bottom) {
+  rows_ = rows;
+  cols_ = cols;
+  right_ = right;
+  bottom_ = bottom;
+  right_->assign(rows_, WallRow(cols_));
+  bottom_->assign(rows_, WallRow(cols_));
+  if (!rows_ || !cols_) return;
+  line_.assign(cols_, -1);
+  parent_.resize(cols_);
+  first_.assign(cols_, -1);
+  open_.assign(cols_, 0);
+
+  for (int i = 0; i < rows_ - 1; i++) {
+    FillLineSet();
+    AddVerticalLine(i, false);
+    AddHorizontalLine(i);
+    AddNewLine(i);
+  }
+  FillLineSet();
+  AddVerticalLine(rows_ - 1, true);
+}
+
+//  множества нумеруются самой левой клеткой, -1 - новая клетка
+void EllerGenerator::FillLineSet() {
+  for (int i = 0; i < cols_; i++) {
+    int set = line_[i];
+    if (set < 0) {
+      parent_[i] = i;
+    } else {
+      if (first_[set] < 0) first_[set] = i;
+      parent_[i] = first_[set];
+    }
+  }
+  for (int i = 0; i < cols_; i++) {
+    if (line_[i] >= 0) first_[line_[i]] = -1;
+    line_[i] = parent_[i];
+  }
+}
+
+int EllerGenerator::Find(int cell) {
+  while (parent_[cell] != cell) {
+    parent_[cell] = parent_[parent_[cell]];
+    cell = parent_[cell];
+  }
+  return cell;
+}
+
+//  добавление вертикальных линий по 64 клетки
+void EllerGenerator::AddVerticalLine(int row, bool last) {
+  WallRow& walls = (*right_)[row];
+  for (int base = 0; base < cols_ - 1; base += 64) {
+    int count = std::min(64, cols_ - 1 - base);
+    std::uint64_t valid = count == 64 ? ~std::uint64_t{0}
+                                      : (std::uint64_t{1} << count) - 1;
+    //  соседи из одного множества на начало строки, без ветвлений
+    std::uint64_t same = 0;
+    for (int j = 0; j < count; j++) {
+      bool joined = line_[base + j] == line_[base + j + 1];
+      same |= static_cast<std::uint64_t>(joined) << j;
+    }
+    std::uint64_t carve = valid & ~same;
+    if (!last) carve &= ~RandomWord();
+    std::uint64_t wall = valid & ~carve;
+    //  проход мог замкнуть петлю через объединения левее в этой строке
+    for (std::uint64_t rest = carve; rest; rest &= rest - 1) {
+      int j = __builtin_ctzll(rest);
+      int a = Find(base + j), b = Find(base + j + 1);
+      if (a == b) {
+        wall |= std::uint64_t{1} << j;
+      } else {
+        parent_[std::max(a, b)] = std::min(a, b);
+      }
+    }
+    for (int j = 0; j < count; j++) walls[base + j] = (wall >> j) & 1;
+  }
+  walls[cols_ - 1] = 1;
+  for (int i = 0; i < cols_; i++) line_[i] = Find(i);
+}
+
+//  добавление горизонтальных линий по 64 клетки
+void EllerGenerator::AddHorizontalLine(int row) {
+  WallRow& walls = (*bottom_)[row];
+  for (int base = 0; base < cols_; base += 64) {
+    std::uint64_t wall = RandomWord();
+    int count = std::min(64, cols_ - base);
+    for (int j = 0; j < count; j++) {
+      walls[base + j] = (wall >> j) & 1;
+      open_[line_[base + j]] |= !walls[base + j];
+    }
+  }
+  //  множеству без прохода вниз открывается самая левая клетка
+  for (int i = 0; i < cols_; i++) {
+    if (!open_[line_[i]]) {
+      walls[i] = 0;
+      open_[line_[i]] = 1;
+    }
+  }
+  for (int i = 0; i < cols_; i++) open_[line_[i]] = 0;
+}
+
+//  добавление новой линии
+void EllerGenerator::AddNewLine(int row) {
+  for (int i = 0; i < cols_; i++) {
+    if ((*bottom_)[row][i] == 1) {
+      line_[i] = -1;
+    }
+  }
+}
+
+void KruskalGenerator::Generate(int rows, int cols, WallMatrix* right,
+                                WallMatrix* bottom) {
+  FillWalls(rows, cols, right, bottom);
+  //  стена задается клеткой и направлением: 2 * cell - справа, +1 - снизу
+  walls_.clear();
+  for (int cell = 0; cell < rows * cols; cell++) {
+    if (cell % cols < cols - 1) walls_.push_back(2 * cell);
+    if (cell / cols < rows - 1) walls_.push_back(2 * cell + 1);
+  }
+  for (int i = static_cast<int>(walls_.size()) - 1; i > 0; i--) {
+    std::swap(walls_[i], walls_[Random(i + 1)]);
+  }
+  parent_.resize(rows * cols);
+  for (int cell = 0; cell < rows * cols; cell++) parent_[cell] = cell;
+  for (int wall : walls_) {
+    int a = wall / 2, b = wall % 2 ? a + cols : a + 1;
+    int root_a = Find(a), root_b = Find(b);
+    if (root_a == root_b) continue;
+    parent_[root_b] = root_a;
+    Carve(cols, a, b, right, bottom);
+  }
+}
+
+int KruskalGenerator::Find(int cell) {
+  //  сокращение пути вдвое
+  while (parent_[cell] != cell) {
+    parent_[cell] = parent_[parent_[cell]];
+    cell = parent_[cell];
+  }
+  return cell;
+}
+
+void WilsonGenerator::Generate(int rows, int cols, WallMatrix* right,
+                               WallMatrix* bottom) {
+  FillWalls(rows, cols, right, bottom);
+  int cells = rows * cols;
+  if (!cells) return;
+  in_tree_.assign(cells, 0);
+  next_.resize(cells);
+  in_tree_[Random(cells)] = 1;
+  int neighbors[4];
+  for (int cell = 0; cell < cells; cell++) {
+    //  при повторном заходе в клетку ход из нее перезаписывается, так
+    //  петли стираются без хранения самого пути
+    for (int current = cell; !in_tree_[current]; current = next_[current]) {
+      int n = Neighbors(rows, cols, current, neighbors);
+      next_[current] = neighbors[Random(n)];
+    }
+    for (int current = cell; !in_tree_[current]; current = next_[current]) {
+      in_tree_[current] = 1;
+      Carve(cols, current, next_[current], right, bottom);
+    }
+  }
+}
+
+void BacktrackerGenerator::Generate(int rows, int cols, WallMatrix* right,
+                                    WallMatrix* bottom) {
+  FillWalls(rows, cols, right, bottom);
+  int cells = rows * cols;
+  if (!cells) return;
+  visited_.assign(cells, 0);
+  stack_.clear();
+  int start = Random(cells);
+  visited_[start] = 1;
+  stack_.push_back(start);
+  int neighbors[4], fresh[4];
+  while (!stack_.empty()) {
+    int cell = stack_.back();
+    int count = 0;
+    for (int i = 0, n = Neighbors(rows, cols, cell, neighbors); i < n; i++) {
+      if (!visited_[neighbors[i]]) fresh[count++] = neighbors[i];
+    }
+    if (!count) {
+      stack_.pop_back();
+      continue;
+    }
+    int next = fresh[Random(count)];
+    Carve(cols, cell, next, right, bottom);
+    visited_[next] = 1;
+    stack_.push_back(next);
+  }
+}
+
+void StreamingGenerator::Generate(int rows, int cols, WallMatrix* right,
+                                  WallMatrix* bottom) {
+  right->resize(rows);
+  bottom->resize(rows);
+  Stream(rows, cols,
+         [right, bottom](int row, const WallRow& right_row,
+                         const WallRow& bottom_row) {
+           (*right)[row] = right_row;
+           (*bottom)[row] = bottom_row;
+         });
+}
+
+void SidewinderGenerator::Stream(int rows, int cols, const RowSink& sink) {
+  WallRow right(cols), bottom(cols);
+  for (int row = 0; row < rows; row++) {
+    //  последняя строка - один сплошной отрезок
+    bool last = row == rows - 1;
+    int run = 0;
+    for (int col = 0; col < cols; col++) {
+      bool close = col == cols - 1 || (!last && RandomBit());
+      right[col] = close;
+      bottom[col] = 1;
+      if (!close) continue;
+      if (!last) bottom[run + Random(col - run + 1)] = 0;
+      run = col + 1;
+    }
+    sink(row, right, bottom);
+  }
+}
+
+void BinaryTreeGenerator::Stream(int rows, int cols, const RowSink& sink) {
+  WallRow right(cols), bottom(cols);
+  for (int row = 0; row < rows; row++) {
+    for (int col = 0; col < cols; col++) {
+      bool east = col < cols - 1, south = row < rows - 1;
+      right[col] = 1;
+      bottom[col] = 1;
+      if (east && (!south || RandomBit())) {
+        right[col] = 0;
+      } else if (south) {
+        bottom[col] = 0;
+      }
+    }
+    sink(row, right, bottom);
+  }
+}
+
+}  // namespace s21
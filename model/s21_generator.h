@@ -0,0 +1,248 @@
+#ifndef SRC_MODEL_S21_GENERATOR_H_
+#define SRC_MODEL_S21_GENERATOR_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "s21_fixed_maze.h"
+#include "s21_memory.h"
+
+namespace s21 {
+
+/**
+ * Алгоритм генерации лабиринта
+ */
+enum class GeneratorKind {
+  kEller,
+  kKruskal,
+  kWilson,
+  kBacktracker,
+  kSidewinder,
+  kBinaryTree
+};
+
+/**
+ * Все алгоритмы генерации по порядку
+ */
+inline constexpr GeneratorKind kGeneratorKinds[] = {
+    GeneratorKind::kEller,       GeneratorKind::kKruskal,
+    GeneratorKind::kWilson,      GeneratorKind::kBacktracker,
+    GeneratorKind::kSidewinder,  GeneratorKind::kBinaryTree};
+
+/**
+ * Метод получения названия алгоритма генерации
+ * @param kind - алгоритм
+ * @return - название: eller, kruskal, wilson, backtracker, sidewinder,
+ * binary-tree
+ */
+const char* GeneratorName(GeneratorKind kind);
+/**
+ * Метод выбора алгоритма генерации по названию
+ * @param name - название в формате GeneratorName
+ * @return - алгоритм
+ */
+GeneratorKind GeneratorFromName(const std::string& name);
+
+/**
+ * Генератор идеального лабиринта. Рабочие буферы генератора сохраняются
+ * между вызовами
+ */
+class MazeGenerator {
+ public:
+  /**
+   * Конструктор
+   * @param seed - зерно генератора случайных чисел
+   */
+  explicit MazeGenerator(std::uint64_t seed) : rng_(seed) {}
+  virtual ~MazeGenerator() = default;
+  /**
+   * Метод смены зерна генератора случайных чисел
+   * @param seed - зерно
+   */
+  void Seed(std::uint64_t seed) { rng_ = SplitMix64(seed); }
+  /**
+   * Метод генерации лабиринта
+   * @param rows - число строк
+   * @param cols - число столбцов
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   */
+  virtual void Generate(int rows, int cols, WallMatrix* right,
+                        WallMatrix* bottom) = 0;
+
+ protected:
+  /**
+   * Метод получения случайного бита
+   */
+  int RandomBit() { return rng_.NextBit(); }
+  /**
+   * Метод получения 64 случайных бит
+   */
+  std::uint64_t RandomWord() { return rng_.Next(); }
+  /**
+   * Метод получения случайного числа от 0 до bound - 1
+   */
+  int Random(int bound) { return static_cast<int>(rng_.Next() % bound); }
+
+ private:
+  SplitMix64 rng_;
+};
+
+/**
+ * Алгоритм Эллера: лабиринт строится по строкам, клетки строки
+ * распределяются по множествам. Стены строки решаются словами по 64
+ * клетки: случайное 64-битное слово дает кандидатов в проходы, маска
+ * соседей из одного множества отсекает заведомые петли, а объединения
+ * множеств выполняются только для оставшихся проходов. Множество строки
+ * обозначается номером своей самой левой клетки, поэтому рабочие массивы
+ * не длиннее строки
+ */
+class EllerGenerator : public MazeGenerator {
+ public:
+  using MazeGenerator::MazeGenerator;
+  void Generate(int rows, int cols, WallMatrix* right,
+                WallMatrix* bottom) override;
+
+ protected:
+  /**
+   * Метод заполнения линии множествами: новые клетки получают свои
+   * множества, продолжающиеся множества - номер самой левой клетки
+   */
+  void FillLineSet();
+  /**
+   * Метод поиска множества клетки с сокращением путей
+   * @param cell - столбец клетки
+   */
+  int Find(int cell);
+  /**
+   * Метод добавления стен справа в линию
+   * @param row - индекс линии
+   * @param last - последняя линия, в ней соединяются все множества
+   */
+  void AddVerticalLine(int row, bool last);
+  /**
+   * Метод добавления стен снизу в линию, у каждого множества остается
+   * хотя бы один проход вниз
+   * @param row - индекс линии
+   */
+  void AddHorizontalLine(int row);
+  /**
+   * Метод подготовки следующей линии: клетки под стенами начинают новые
+   * множества
+   * @param row - индекс линии
+   */
+  void AddNewLine(int row);
+
+ private:
+  int rows_ = 0;
+  int cols_ = 0;
+  std::vector<int> line_;
+  std::vector<int> parent_;
+  std::vector<int> first_;
+  std::vector<char> open_;
+  WallMatrix* right_ = nullptr;
+  WallMatrix* bottom_ = nullptr;
+};
+
+/**
+ * Алгоритм Краскала: стены удаляются в случайном порядке, если
+ * соединяют разные множества. Множества хранятся в плоском массиве
+ */
+class KruskalGenerator : public MazeGenerator {
+ public:
+  using MazeGenerator::MazeGenerator;
+  void Generate(int rows, int cols, WallMatrix* right,
+                WallMatrix* bottom) override;
+
+ private:
+  int Find(int cell);
+
+  std::vector<int> parent_;
+  std::vector<int> walls_;
+};
+
+/**
+ * Алгоритм Уилсона: случайные блуждания со стиранием петель до уже
+ * построенного дерева. Лабиринт выбирается равновероятно среди всех
+ * остовных деревьев
+ */
+class WilsonGenerator : public MazeGenerator {
+ public:
+  using MazeGenerator::MazeGenerator;
+  void Generate(int rows, int cols, WallMatrix* right,
+                WallMatrix* bottom) override;
+
+ private:
+  std::vector<char> in_tree_;
+  std::vector<int> next_;
+};
+
+/**
+ * Поиск с возвратом на явном стеке: длинные извилистые коридоры
+ */
+class BacktrackerGenerator : public MazeGenerator {
+ public:
+  using MazeGenerator::MazeGenerator;
+  void Generate(int rows, int cols, WallMatrix* right,
+                WallMatrix* bottom) override;
+
+ private:
+  std::vector<char> visited_;
+  std::vector<int> stack_;
+};
+
+/**
+ * Генератор, которому для очередной строки нужна только она сама.
+ * Строки отдаются по одной, поэтому лабиринт можно писать сразу в файл
+ */
+class StreamingGenerator : public MazeGenerator {
+ public:
+  /**
+   * Приемник готовой строки: номер строки, стены справа и снизу
+   */
+  using RowSink = std::function<void(int, const WallRow&, const WallRow&)>;
+
+  using MazeGenerator::MazeGenerator;
+  void Generate(int rows, int cols, WallMatrix* right,
+                WallMatrix* bottom) override;
+  /**
+   * Метод генерации лабиринта по строкам
+   * @param rows - число строк
+   * @param cols - число столбцов
+   * @param sink - приемник строк
+   */
+  virtual void Stream(int rows, int cols, const RowSink& sink) = 0;
+};
+
+/**
+ * Алгоритм sidewinder: строка делится на отрезки, каждый отрезок
+ * открывается вниз в одной случайной клетке
+ */
+class SidewinderGenerator : public StreamingGenerator {
+ public:
+  using StreamingGenerator::StreamingGenerator;
+  void Stream(int rows, int cols, const RowSink& sink) override;
+};
+
+/**
+ * Двоичное дерево: каждая клетка открывается вправо или вниз
+ */
+class BinaryTreeGenerator : public StreamingGenerator {
+ public:
+  using StreamingGenerator::StreamingGenerator;
+  void Stream(int rows, int cols, const RowSink& sink) override;
+};
+
+/**
+ * Метод создания генератора
+ * @param kind - алгоритм
+ * @param seed - зерно генератора случайных чисел
+ */
+std::unique_ptr<MazeGenerator> MakeGenerator(GeneratorKind kind,
+                                             std::uint64_t seed);
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_GENERATOR_H_
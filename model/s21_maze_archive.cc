@@ -0,0 +1,224 @@
+#include "s21_maze_archive.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace s21 {
+
+namespace {
+
+constexpr char kMagic[8] = {'S', '2', '1', 'M', 'A', 'Z', 'E', '\0'};
+constexpr std::uint32_t kVersion = 2;
+//  емкость индекса нового архива
+constexpr std::uint32_t kMinCapacity = 16;
+
+struct Header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t count;
+  std::uint64_t index_offset;
+  std::uint32_t capacity;
+  std::uint32_t reserved;
+};
+
+//  число 64-битных слов в упакованной строке
+std::size_t RowWords(std::uint32_t cols) { return (cols + 63) / 64; }
+
+//  индекс целиком лежит в файле; проверка без переполнения, так как
+//  заголовок может быть поврежден
+bool IsValidHeader(const Header& header, std::size_t size) {
+  return std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+         header.version == kVersion &&
+         header.index_offset % sizeof(std::uint64_t) == 0 &&
+         header.index_offset <= size && header.count <= header.capacity &&
+         header.capacity <= (size - header.index_offset) /
+                                sizeof(MazeArchive::Entry);
+}
+
+bool ReadAt(int fd, void* data, std::size_t size, std::uint64_t offset) {
+  char* bytes = static_cast<char*>(data);
+  while (size) {
+    ssize_t count = pread(fd, bytes, size, offset);
+    if (count < 0 && errno == EINTR) continue;
+    if (count <= 0) return false;
+    bytes += count;
+    size -= count;
+    offset += count;
+  }
+  return true;
+}
+
+bool WriteAt(int fd, const void* data, std::size_t size,
+             std::uint64_t offset) {
+  const char* bytes = static_cast<const char*>(data);
+  while (size) {
+    ssize_t count = pwrite(fd, bytes, size, offset);
+    if (count < 0 && errno == EINTR) continue;
+    if (count <= 0) return false;
+    bytes += count;
+    size -= count;
+    offset += count;
+  }
+  return true;
+}
+
+std::size_t BlobSize(std::uint32_t rows, std::uint32_t cols) {
+  return 2 * std::size_t{rows} * RowWords(cols) * sizeof(std::uint64_t);
+}
+
+void PackMatrix(const WallMatrix& matrix, std::vector<std::uint64_t>* words) {
+  for (const auto& row : matrix) {
+    std::size_t base = words->size();
+    words->resize(base + RowWords(row.size()), 0);
+    for (std::size_t j = 0; j < row.size(); j++) {
+      if (row[j]) (*words)[base + j / 64] |= std::uint64_t{1} << (j % 64);
+    }
+  }
+}
+
+void UnpackMatrix(const std::uint64_t* words, std::uint32_t rows,
+                  std::uint32_t cols, WallMatrix* matrix) {
+  std::size_t row_words = RowWords(cols);
+  matrix->assign(rows, WallRow(cols));
+  for (std::uint32_t i = 0; i < rows; i++) {
+    const std::uint64_t* row = words + i * row_words;
+    for (std::uint32_t j = 0; j < cols; j++) {
+      (*matrix)[i][j] = (row[j / 64] >> (j % 64)) & 1;
+    }
+  }
+}
+
+}  // namespace
+
+MazeArchive::MazeArchive() {}
+
+MazeArchive::~MazeArchive() { Close(); }
+
+long MazeArchive::Append(const std::string& filename, const WallMatrix& right,
+                         const WallMatrix& bottom) {
+  if (right.empty() || right.size() != bottom.size()) return -1;
+
+  int fd = open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd < 0) return -1;
+  //  писатели ждут друг друга, закрытие файла снимает блокировку
+  struct stat st;
+  Header header{};
+  bool ok = flock(fd, LOCK_EX) == 0 && fstat(fd, &st) == 0;
+  if (ok && st.st_size == 0) {
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.index_offset = sizeof(Header);
+  } else if (ok) {
+    ok = ReadAt(fd, &header, sizeof(header), 0) &&
+         IsValidHeader(header, st.st_size);
+  }
+  if (!ok) {
+    close(fd);
+    return -1;
+  }
+
+  //  новые данные пишутся за концом файла и в свободные записи индекса, на
+  //  которые заголовок еще не ссылается. Заголовок переписывается
+  //  последним, после fsync, поэтому при сбое архив остается прежним
+  std::vector<std::uint64_t> words;
+  PackMatrix(right, &words);
+  PackMatrix(bottom, &words);
+  std::uint64_t end = std::max<std::uint64_t>(st.st_size, sizeof(Header));
+  end = (end + 7) & ~std::uint64_t{7};
+  Entry entry = {end, static_cast<std::uint32_t>(right.size()),
+                 static_cast<std::uint32_t>(right[0].size())};
+  end += words.size() * sizeof(std::uint64_t);
+  ok = WriteAt(fd, words.data(), words.size() * sizeof(std::uint64_t),
+               entry.offset);
+  if (ok && header.count < header.capacity) {
+    ok = WriteAt(fd, &entry, sizeof(entry),
+                 header.index_offset + header.count * sizeof(Entry));
+  } else if (ok) {
+    //  индекс заполнен и переносится в конец файла с удвоенной емкостью,
+    //  старое место индекса больше не используется
+    std::vector<Entry> index(std::max(kMinCapacity, 2 * header.capacity));
+    ok = ReadAt(fd, index.data(), header.count * sizeof(Entry),
+                header.index_offset);
+    index[header.count] = entry;
+    ok = ok && WriteAt(fd, index.data(), index.size() * sizeof(Entry), end);
+    header.index_offset = end;
+    header.capacity = index.size();
+  }
+  header.count++;
+  ok = ok && fsync(fd) == 0 && WriteAt(fd, &header, sizeof(header), 0) &&
+       fsync(fd) == 0;
+  ok = close(fd) == 0 && ok;
+  return ok ? static_cast<long>(header.count - 1) : -1;
+}
+
+bool MazeArchive::Open(const std::string& filename) {
+  Close();
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  //  блокировка на время чтения размера и отображения, чтобы не увидеть
+  //  заголовок посередине записи. Отображение держит файл открытым, поэтому
+  //  блокировка снимается явно
+  struct stat st;
+  if (flock(fd, LOCK_SH) != 0 || fstat(fd, &st) != 0 ||
+      st.st_size < static_cast<off_t>(sizeof(Header))) {
+    close(fd);
+    return false;
+  }
+  void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  flock(fd, LOCK_UN);
+  close(fd);
+  if (data == MAP_FAILED) return false;
+  data_ = static_cast<const unsigned char*>(data);
+  size_ = st.st_size;
+
+  const Header* header = reinterpret_cast<const Header*>(data_);
+  if (!IsValidHeader(*header, size_)) {
+    Close();
+    return false;
+  }
+  index_ = reinterpret_cast<const Entry*>(data_ + header->index_offset);
+  count_ = header->count;
+  return true;
+}
+
+void MazeArchive::Close() {
+  if (data_) munmap(const_cast<unsigned char*>(data_), size_);
+  data_ = nullptr;
+  size_ = 0;
+  index_ = nullptr;
+  count_ = 0;
+}
+
+std::size_t MazeArchive::Size() const { return count_; }
+
+const MazeArchive::Entry& MazeArchive::GetEntry(std::size_t id) const {
+  if (id >= count_) {
+    throw std::out_of_range("Нет лабиринта с таким номером в архиве.");
+  }
+  return index_[id];
+}
+
+void MazeArchive::Load(std::size_t id, WallMatrix* right,
+                       WallMatrix* bottom) const {
+  const Entry& entry = GetEntry(id);
+  std::size_t blob = BlobSize(entry.rows, entry.cols);
+  if (blob > size_ || entry.offset > size_ - blob ||
+      entry.offset % sizeof(std::uint64_t)) {
+    throw std::runtime_error("Поврежденный архив лабиринтов.");
+  }
+  const std::uint64_t* words =
+      reinterpret_cast<const std::uint64_t*>(data_ + entry.offset);
+  UnpackMatrix(words, entry.rows, entry.cols, right);
+  UnpackMatrix(words + blob / 2 / sizeof(std::uint64_t), entry.rows,
+               entry.cols, bottom);
+}
+
+}  // namespace s21
@@ -0,0 +1,99 @@
+#ifndef SRC_MODEL_S21_MAZE_ARCHIVE_H_
+#define SRC_MODEL_S21_MAZE_ARCHIVE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "s21_memory.h"
+
+namespace s21 {
+
+/**
+ * Архив из множества лабиринтов в одном файле. Файл состоит из заголовка,
+ * упакованных по битам лабиринтов и индекса с запасом свободных записей.
+ * Индекс хранит смещение и размеры каждого лабиринта, поэтому любой
+ * лабиринт читается из отображенного в память файла без просмотра
+ * остальных. Запись только дописывает файл и заполняет свободные записи
+ * индекса, а изменения видны после перезаписи заголовка, поэтому сбой
+ * посередине не портит архив. Писатели разных процессов упорядочены
+ * блокировкой flock.
+ */
+class MazeArchive {
+ public:
+  /**
+   * Запись индекса архива
+   */
+  struct Entry {
+    /**
+     * Смещение данных лабиринта от начала файла
+     */
+    std::uint64_t offset;
+    /**
+     * Число строк лабиринта
+     */
+    std::uint32_t rows;
+    /**
+     * Число столбцов лабиринта
+     */
+    std::uint32_t cols;
+  };
+
+  /**
+   * Конструктор
+   */
+  MazeArchive();
+  /**
+   * Деструктор, снимает отображение файла
+   */
+  ~MazeArchive();
+  MazeArchive(const MazeArchive&) = delete;
+  MazeArchive& operator=(const MazeArchive&) = delete;
+
+  /**
+   * Метод добавления лабиринта в конец архива, архив создается при
+   * отсутствии
+   * @param filename - имя файла архива
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @return - номер добавленного лабиринта или -1 при ошибке
+   */
+  static long Append(const std::string& filename, const WallMatrix& right,
+                     const WallMatrix& bottom);
+  /**
+   * Метод открытия архива на чтение
+   * @param filename - имя файла архива
+   * @return - удалось ли открыть архив
+   */
+  bool Open(const std::string& filename);
+  /**
+   * Метод закрытия архива
+   */
+  void Close();
+  /**
+   * Метод получения числа лабиринтов в архиве
+   */
+  std::size_t Size() const;
+  /**
+   * Метод получения записи индекса
+   * @param id - номер лабиринта
+   */
+  const Entry& GetEntry(std::size_t id) const;
+  /**
+   * Метод чтения лабиринта по номеру
+   * @param id - номер лабиринта
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   */
+  void Load(std::size_t id, WallMatrix* right, WallMatrix* bottom) const;
+
+ private:
+  const unsigned char* data_ = nullptr;
+  std::size_t size_ = 0;
+  const Entry* index_ = nullptr;
+  std::size_t count_ = 0;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_MAZE_ARCHIVE_H_
@@ -0,0 +1,85 @@
+#include "s21_maze_hash.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+std::uint64_t Rotate(std::uint64_t value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+std::uint64_t Round(std::uint64_t lane, std::uint64_t word) {
+  return Rotate(lane + word * kPrime2, 31) * kPrime1;
+}
+
+std::uint64_t Merge(std::uint64_t hash, std::uint64_t lane) {
+  return (hash ^ Round(0, lane)) * kPrime1 + kPrime4;
+}
+
+}  // namespace
+
+std::uint64_t MazeHash::Finish(int rows, int cols) {
+  if (filled_) AddWord(bits_);
+  std::uint64_t hash;
+  if (words_ >= 4) {
+    hash = Rotate(lanes_[0], 1) + Rotate(lanes_[1], 7) +
+           Rotate(lanes_[2], 12) + Rotate(lanes_[3], 18);
+    for (std::uint64_t lane : lanes_) hash = Merge(hash, lane);
+  } else {
+    hash = kPrime5;
+  }
+  hash += words_ * sizeof(std::uint64_t);
+  //  хвост неполной полосы и размеры, без размеров лабиринты 2x8 и 4x4
+  //  с одинаковыми стенами совпадали бы
+  stripe_[stripe_words_++] =
+      static_cast<std::uint64_t>(static_cast<std::uint32_t>(rows)) << 32 |
+      static_cast<std::uint32_t>(cols);
+  for (int i = 0; i < stripe_words_; i++) {
+    hash ^= Round(0, stripe_[i]);
+    hash = Rotate(hash, 27) * kPrime1 + kPrime4;
+  }
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime3;
+  hash ^= hash >> 32;
+  Reset();
+  return hash;
+}
+
+std::uint64_t MazeHash::Of(const WallMatrix& right, const WallMatrix& bottom) {
+  MazeHash hash;
+  for (const auto* matrix : {&right, &bottom}) {
+    for (const auto& row : *matrix) {
+      for (int wall : row) hash.Add(wall);
+    }
+  }
+  return hash.Finish(right.size(), right.empty() ? 0 : right[0].size());
+}
+
+void MazeHash::AddWord(std::uint64_t word) {
+  words_++;
+  stripe_[stripe_words_++] = word;
+  if (stripe_words_ < 4) return;
+  for (int i = 0; i < 4; i++) lanes_[i] = Round(lanes_[i], stripe_[i]);
+  stripe_words_ = 0;
+}
+
+void MazeHash::Reset() {
+  lanes_[0] = kPrime1 + kPrime2;
+  lanes_[1] = kPrime2;
+  lanes_[2] = 0;
+  lanes_[3] = -kPrime1;
+  stripe_words_ = 0;
+  words_ = 0;
+  bits_ = 0;
+  filled_ = 0;
+}
+
+}  // namespace s21
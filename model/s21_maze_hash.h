@@ -0,0 +1,61 @@
+#ifndef SRC_MODEL_S21_MAZE_HASH_H_
+#define SRC_MODEL_S21_MAZE_HASH_H_
+
+#include <cstdint>
+
+#include "s21_memory.h"
+
+namespace s21 {
+
+/**
+ * Хэш содержимого лабиринта по схеме xxHash64. Стены справа, затем стены
+ * снизу по строкам упаковываются по одному биту в 64-битные слова, слова
+ * перемешиваются четырьмя независимыми аккумуляторами, в конце
+ * добавляются размеры. Хэш считается потоково, по одной стене, поэтому
+ * его можно считать во время чтения файла
+ */
+class MazeHash {
+ public:
+  /**
+   * Конструктор
+   */
+  MazeHash() { Reset(); }
+  /**
+   * Метод добавления очередной стены
+   * @param wall - стена, любое ненулевое значение считается стеной
+   */
+  void Add(int wall) {
+    bits_ |= static_cast<std::uint64_t>(wall != 0) << filled_;
+    if (++filled_ == 64) {
+      AddWord(bits_);
+      bits_ = 0;
+      filled_ = 0;
+    }
+  }
+  /**
+   * Метод получения хэша, после него хэш начинается заново
+   * @param rows - число строк лабиринта
+   * @param cols - число столбцов лабиринта
+   */
+  std::uint64_t Finish(int rows, int cols);
+  /**
+   * Метод подсчета хэша матриц, совпадает с потоковым подсчетом
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   */
+  static std::uint64_t Of(const WallMatrix& right, const WallMatrix& bottom);
+
+ private:
+  void AddWord(std::uint64_t word);
+  void Reset();
+
+  std::uint64_t lanes_[4];
+  std::uint64_t stripe_[4];
+  int stripe_words_;
+  std::uint64_t words_;
+  std::uint64_t bits_;
+  int filled_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_MAZE_HASH_H_
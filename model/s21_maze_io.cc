@@ -0,0 +1,323 @@
+#include "s21_maze_io.h"
+
+#include <zlib.h>
+
+#include <cstdio>
+#include <stdexcept>
+
+#ifdef S21_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+namespace s21 {
+
+namespace {
+
+constexpr std::size_t kFileChunk = 1 << 16;
+
+//  несжатый файл
+class FileInput : public InputStream {
+ public:
+  explicit FileInput(std::FILE* file) : file_(file) {}
+  ~FileInput() override { std::fclose(file_); }
+  std::size_t Read(char* data, std::size_t size) override {
+    return std::fread(data, 1, size, file_);
+  }
+
+ protected:
+  std::FILE* file_;
+};
+
+//  gzip или zlib: распаковка порциями через inflate
+class GzipInput : public FileInput {
+ public:
+  explicit GzipInput(std::FILE* file) : FileInput(file), in_(kFileChunk) {
+    if (inflateInit2(&stream_, 15 + 32) != Z_OK) {
+      throw std::runtime_error("Не удалось инициализировать zlib.");
+    }
+  }
+  ~GzipInput() override { inflateEnd(&stream_); }
+  std::size_t Read(char* data, std::size_t size) override {
+    stream_.next_out = reinterpret_cast<Bytef*>(data);
+    stream_.avail_out = static_cast<uInt>(size);
+    while (stream_.avail_out == size) {
+      if (stream_.avail_in == 0) {
+        stream_.avail_in = std::fread(in_.data(), 1, in_.size(), file_);
+        stream_.next_in = reinterpret_cast<Bytef*>(in_.data());
+        if (stream_.avail_in == 0) {
+          if (!finished_) throw std::runtime_error("Файл gzip обрезан.");
+          break;
+        }
+      }
+      int status = inflate(&stream_, Z_NO_FLUSH);
+      finished_ = status == Z_STREAM_END;
+      if (finished_) {
+        inflateReset(&stream_);  // следующий gzip-блок в том же файле
+      } else if (status != Z_OK && status != Z_BUF_ERROR) {
+        throw std::runtime_error("Поврежденный файл gzip.");
+      }
+    }
+    return size - stream_.avail_out;
+  }
+
+ private:
+  std::vector<char> in_;
+  z_stream stream_{};
+  bool finished_ = false;
+};
+
+class FileOutput : public OutputStream {
+ public:
+  explicit FileOutput(std::FILE* file) : file_(file) {}
+  ~FileOutput() override {
+    if (file_) std::fclose(file_);
+  }
+  bool Write(const char* data, std::size_t size) override {
+    return std::fwrite(data, 1, size, file_) == size;
+  }
+  bool Close() override {
+    bool ok = std::fclose(file_) == 0;
+    file_ = nullptr;
+    return ok;
+  }
+
+ protected:
+  std::FILE* file_;
+};
+
+class GzipOutput : public FileOutput {
+ public:
+  explicit GzipOutput(std::FILE* file) : FileOutput(file), out_(kFileChunk) {
+    if (deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      throw std::runtime_error("Не удалось инициализировать zlib.");
+    }
+  }
+  ~GzipOutput() override { deflateEnd(&stream_); }
+  bool Write(const char* data, std::size_t size) override {
+    stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream_.avail_in = static_cast<uInt>(size);
+    return Deflate(Z_NO_FLUSH);
+  }
+  bool Close() override {
+    bool ok = Deflate(Z_FINISH);
+    return FileOutput::Close() && ok;
+  }
+
+ private:
+  bool Deflate(int flush) {
+    int status = Z_OK;
+    do {
+      stream_.next_out = reinterpret_cast<Bytef*>(out_.data());
+      stream_.avail_out = static_cast<uInt>(out_.size());
+      status = deflate(&stream_, flush);
+      if (status == Z_STREAM_ERROR ||
+          !FileOutput::Write(out_.data(), out_.size() - stream_.avail_out)) {
+        return false;
+      }
+    } while (stream_.avail_out == 0 ||
+             (flush == Z_FINISH && status != Z_STREAM_END));
+    return true;
+  }
+
+  std::vector<char> out_;
+  z_stream stream_{};
+};
+
+#ifdef S21_WITH_ZSTD
+class ZstdInput : public FileInput {
+ public:
+  explicit ZstdInput(std::FILE* file)
+      : FileInput(file),
+        in_(ZSTD_DStreamInSize()),
+        dstream_(ZSTD_createDStream()) {
+    ZSTD_initDStream(dstream_);
+  }
+  ~ZstdInput() override { ZSTD_freeDStream(dstream_); }
+  std::size_t Read(char* data, std::size_t size) override {
+    ZSTD_outBuffer out = {data, size, 0};
+    while (out.pos == 0) {
+      if (in_buf_.pos == in_buf_.size) {
+        in_buf_.size = std::fread(in_.data(), 1, in_.size(), file_);
+        in_buf_.src = in_.data();
+        in_buf_.pos = 0;
+        if (in_buf_.size == 0) {
+          if (!finished_) throw std::runtime_error("Файл zstd обрезан.");
+          break;
+        }
+      }
+      std::size_t status = ZSTD_decompressStream(dstream_, &out, &in_buf_);
+      if (ZSTD_isError(status)) {
+        throw std::runtime_error("Поврежденный файл zstd.");
+      }
+      finished_ = status == 0;
+    }
+    return out.pos;
+  }
+
+ private:
+  std::vector<char> in_;
+  ZSTD_inBuffer in_buf_ = {nullptr, 0, 0};
+  ZSTD_DStream* dstream_;
+  bool finished_ = false;
+};
+
+class ZstdOutput : public FileOutput {
+ public:
+  explicit ZstdOutput(std::FILE* file)
+      : FileOutput(file),
+        out_(ZSTD_CStreamOutSize()),
+        cctx_(ZSTD_createCCtx()) {}
+  ~ZstdOutput() override { ZSTD_freeCCtx(cctx_); }
+  bool Write(const char* data, std::size_t size) override {
+    ZSTD_inBuffer in = {data, size, 0};
+    return Compress(&in, ZSTD_e_continue);
+  }
+  bool Close() override {
+    ZSTD_inBuffer in = {nullptr, 0, 0};
+    bool ok = Compress(&in, ZSTD_e_end);
+    return FileOutput::Close() && ok;
+  }
+
+ private:
+  bool Compress(ZSTD_inBuffer* in, ZSTD_EndDirective mode) {
+    std::size_t remaining = 0;
+    do {
+      ZSTD_outBuffer out = {out_.data(), out_.size(), 0};
+      remaining = ZSTD_compressStream2(cctx_, &out, in, mode);
+      if (ZSTD_isError(remaining) || !FileOutput::Write(out_.data(), out.pos)) {
+        return false;
+      }
+    } while (mode == ZSTD_e_end ? remaining != 0 : in->pos != in->size);
+    return true;
+  }
+
+  std::vector<char> out_;
+  ZSTD_CCtx* cctx_;
+};
+#endif
+
+}  // namespace
+
+Compression CompressionFromName(const std::string& filename) {
+  auto ends_with = [&filename](const std::string& suffix) {
+    return filename.size() >= suffix.size() &&
+           filename.compare(filename.size() - suffix.size(), suffix.size(),
+                            suffix) == 0;
+  };
+  if (ends_with(".gz")) return Compression::kGzip;
+  if (ends_with(".zst")) return Compression::kZstd;
+  return Compression::kNone;
+}
+
+std::unique_ptr<InputStream> OpenInput(const std::string& filename) {
+  std::FILE* file = std::fopen(filename.c_str(), "rb");
+  if (!file) return nullptr;
+
+  unsigned char magic[4] = {0, 0, 0, 0};
+  std::size_t count = std::fread(magic, 1, sizeof(magic), file);
+  std::rewind(file);
+
+  if (count >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) {
+    return std::make_unique<GzipInput>(file);
+  }
+  if (count == 4 && magic[0] == 0x28 && magic[1] == 0xB5 && magic[2] == 0x2F &&
+      magic[3] == 0xFD) {
+#ifdef S21_WITH_ZSTD
+    return std::make_unique<ZstdInput>(file);
+#else
+    std::fclose(file);
+    throw std::runtime_error("Поддержка zstd не включена в сборку.");
+#endif
+  }
+  return std::make_unique<FileInput>(file);
+}
+
+std::unique_ptr<OutputStream> OpenOutput(const std::string& filename,
+                                         Compression compression) {
+#ifndef S21_WITH_ZSTD
+  if (compression == Compression::kZstd) {
+    throw std::runtime_error("Поддержка zstd не включена в сборку.");
+  }
+#endif
+  std::FILE* file = std::fopen(filename.c_str(), "wb");
+  if (!file) return nullptr;
+  switch (compression) {
+    case Compression::kGzip:
+      return std::make_unique<GzipOutput>(file);
+#ifdef S21_WITH_ZSTD
+    case Compression::kZstd:
+      return std::make_unique<ZstdOutput>(file);
+#endif
+    default:
+      return std::make_unique<FileOutput>(file);
+  }
+}
+
+TokenReader::TokenReader(InputStream* input)
+    : input_(input), buffer_(kChunkSize) {}
+
+void TokenReader::Fill() {
+  pos_ = 0;
+  size_ = failed_ ? 0 : input_->Read(buffer_.data(), buffer_.size());
+  failed_ = size_ == 0;
+}
+
+int TokenReader::Peek() {
+  if (pos_ == size_) Fill();
+  return pos_ < size_ ? static_cast<unsigned char>(buffer_[pos_]) : EOF;
+}
+
+bool TokenReader::NextInt(int* value) {
+  int c = Peek();
+  while (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+    pos_++;
+    c = Peek();
+  }
+  bool negative = c == '-';
+  if (c == '-' || c == '+') {
+    pos_++;
+    c = Peek();
+  }
+  if (c < '0' || c > '9') return false;
+  long long result = 0;
+  while (c >= '0' && c <= '9') {
+    result = result * 10 + (c - '0');
+    if (result > 0x7FFFFFFF) return false;
+    pos_++;
+    c = Peek();
+  }
+  *value = static_cast<int>(negative ? -result : result);
+  return true;
+}
+
+TokenWriter::TokenWriter(OutputStream* output) : output_(output) {
+  buffer_.reserve(kFileChunk + 16);
+}
+
+void TokenWriter::Flush() {
+  ok_ = output_->Write(buffer_.data(), buffer_.size()) && ok_;
+  buffer_.clear();
+}
+
+void TokenWriter::Write(int value, char separator) {
+  if (value == 0 || value == 1) {
+    buffer_ += static_cast<char>('0' + value);
+  } else {
+    buffer_ += std::to_string(value);
+  }
+  buffer_ += separator;
+  if (buffer_.size() >= kFileChunk) Flush();
+}
+
+void TokenWriter::NewLine() {
+  buffer_ += '\n';
+  if (buffer_.size() >= kFileChunk) Flush();
+}
+
+bool TokenWriter::Close() {
+  Flush();
+  return output_->Close() && ok_;
+}
+
+}  // namespace s21
@@ -0,0 +1,141 @@
+#ifndef SRC_MODEL_S21_MAZE_IO_H_
+#define SRC_MODEL_S21_MAZE_IO_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * Сжатие файла лабиринта
+ */
+enum class Compression { kNone, kGzip, kZstd };
+
+/**
+ * Метод выбора сжатия по расширению файла (.gz, .zst)
+ * @param filename - имя файла
+ * @return - сжатие
+ */
+Compression CompressionFromName(const std::string& filename);
+
+/**
+ * Поток чтения байтов файла. Сжатые файлы распаковываются по частям,
+ * ошибки формата сообщаются исключением std::runtime_error
+ */
+class InputStream {
+ public:
+  virtual ~InputStream() = default;
+  /**
+   * Метод чтения очередной порции байтов
+   * @param data - буфер
+   * @param size - размер буфера
+   * @return - число прочитанных байтов, 0 в конце файла
+   */
+  virtual std::size_t Read(char* data, std::size_t size) = 0;
+};
+
+/**
+ * Поток записи байтов в файл с возможным сжатием
+ */
+class OutputStream {
+ public:
+  virtual ~OutputStream() = default;
+  /**
+   * Метод записи байтов
+   * @param data - данные
+   * @param size - размер данных
+   * @return - успешна ли запись
+   */
+  virtual bool Write(const char* data, std::size_t size) = 0;
+  /**
+   * Метод завершения записи
+   * @return - успешна ли запись
+   */
+  virtual bool Close() = 0;
+};
+
+/**
+ * Метод открытия файла на чтение, сжатие определяется по первым байтам
+ * @param filename - имя файла
+ * @return - поток или nullptr, если файл не открылся
+ */
+std::unique_ptr<InputStream> OpenInput(const std::string& filename);
+/**
+ * Метод открытия файла на запись
+ * @param filename - имя файла
+ * @param compression - сжатие
+ * @return - поток или nullptr, если файл не открылся
+ */
+std::unique_ptr<OutputStream> OpenOutput(const std::string& filename,
+                                         Compression compression);
+
+/**
+ * Разбор целых чисел из потока порциями фиксированного размера
+ */
+class TokenReader {
+ public:
+  /**
+   * Размер порции чтения
+   */
+  static constexpr std::size_t kChunkSize = 1 << 16;
+  /**
+   * Конструктор
+   * @param input - поток чтения
+   */
+  explicit TokenReader(InputStream* input);
+  /**
+   * Метод чтения следующего целого числа
+   * @param value - прочитанное число
+   * @return - false, если число прочитать не удалось
+   */
+  bool NextInt(int* value);
+
+ private:
+  int Peek();
+  void Fill();
+
+  InputStream* input_;
+  std::vector<char> buffer_;
+  std::size_t pos_ = 0;
+  std::size_t size_ = 0;
+  bool failed_ = false;
+};
+
+/**
+ * Буферизованная запись текста лабиринта в поток
+ */
+class TokenWriter {
+ public:
+  /**
+   * Конструктор
+   * @param output - поток записи
+   */
+  explicit TokenWriter(OutputStream* output);
+  /**
+   * Метод записи числа и разделителя
+   * @param value - число
+   * @param separator - разделитель
+   */
+  void Write(int value, char separator);
+  /**
+   * Метод записи перевода строки
+   */
+  void NewLine();
+  /**
+   * Метод сброса буфера и завершения записи
+   * @return - успешна ли вся запись
+   */
+  bool Close();
+
+ private:
+  void Flush();
+
+  OutputStream* output_;
+  std::string buffer_;
+  bool ok_ = true;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_MAZE_IO_H_
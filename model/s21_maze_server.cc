@@ -0,0 +1,385 @@
+#include "s21_maze_server.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_step_solver.h"
+#include "s21_thread_pool.h"
+#include "s21_trace.h"
+
+namespace s21 {
+
+namespace {
+
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+//  соединение со строкой длиннее этого предела закрывается
+constexpr std::size_t kMaxRequest = 1 << 16;
+//  клиент, который не читает ответы, держит поток пула не дольше этого
+constexpr int kSendTimeoutSec = 5;
+
+int ParseInt(const std::string& text) {
+  std::size_t used = 0;
+  int value = 0;
+  try {
+    value = std::stoi(text, &used);
+  } catch (const std::exception&) {
+    used = 0;
+  }
+  if (used == 0 || used != text.size()) {
+    throw std::invalid_argument("Неверное число: " + text);
+  }
+  return value;
+}
+
+bool SendAll(int socket, const std::string& data) {
+  for (std::size_t sent = 0; sent < data.size();) {
+    ssize_t count =
+        send(socket, data.data() + sent, data.size() - sent, kSendFlags);
+    if (count < 0 && errno == EINTR) continue;
+    if (count <= 0) return false;
+    sent += count;
+  }
+  return true;
+}
+
+bool MakeAddress(const std::string& path, sockaddr_un* address) {
+  if (path.empty() || path.size() >= sizeof(address->sun_path)) return false;
+  std::memset(address, 0, sizeof(*address));
+  address->sun_family = AF_UNIX;
+  std::memcpy(address->sun_path, path.c_str(), path.size() + 1);
+  return true;
+}
+
+const std::string kBadArgs = "error Неверные аргументы.";
+
+}  // namespace
+
+MazeServer::MazeServer(int threads) : threads_(threads) {}
+
+MazeServer::~MazeServer() { Stop(); }
+
+std::string MazeServer::Handle(const std::string& request) {
+  S21_TRACE_SCOPE("MazeServer::Handle");
+  requests_++;
+  std::istringstream stream(request);
+  std::string command, word;
+  Args args;
+  stream >> command;
+  while (stream >> word) args.push_back(word);
+  try {
+    if (command == "generate") return Generate(args);
+    if (command == "load") return Load(args);
+    if (command == "solve") return Solve(args);
+    if (command == "stats") return Stats(args);
+    if (command == "drop") return Drop(args);
+  } catch (const std::exception& error) {
+    return std::string("error ") + error.what();
+  }
+  return "error Неизвестная команда: " + command;
+}
+
+bool MazeServer::Serve(const std::string& path) {
+  sockaddr_un address;
+  if (!MakeAddress(path, &address)) return false;
+  int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listener < 0) return false;
+  unlink(path.c_str());
+  auto* raw = reinterpret_cast<sockaddr*>(&address);
+  if (bind(listener, raw, sizeof(address)) < 0 ||
+      listen(listener, SOMAXCONN) < 0) {
+    close(listener);
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(sockets_mutex_);
+    listener_ = listener;
+    if (stop_) shutdown(listener, SHUT_RDWR);
+  }
+
+  //  задачи пула сообщают через канал, что соединение снова ждет запросов
+  int wake[2];
+  if (pipe(wake) < 0) {
+    close(listener);
+    return false;
+  }
+
+  //  соединения ждет один этот поток, а пулу отдаются только полностью
+  //  пришедшие строки запросов, поэтому простаивающие клиенты не
+  //  занимают потоки пула
+  struct Connection {
+    std::string buffer;
+    bool busy = false;
+  };
+  std::unordered_map<int, Connection> connections;
+  std::mutex finished_mutex;
+  std::vector<std::pair<int, bool>> finished;
+  auto drop = [this, &connections](int client) {
+    connections.erase(client);
+    {
+      std::lock_guard<std::mutex> lock(sockets_mutex_);
+      clients_.erase(client);
+    }
+    close(client);
+  };
+
+  ThreadPool pool(threads_);
+  std::vector<pollfd> fds;
+  bool running = true;
+  while (running) {
+    fds.assign({{listener, POLLIN, 0}, {wake[0], POLLIN, 0}});
+    for (const auto& [client, connection] : connections) {
+      if (!connection.busy) fds.push_back({client, POLLIN, 0});
+    }
+    if (poll(fds.data(), fds.size(), -1) < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+
+    if (fds[1].revents) {
+      char drain[256];
+      if (read(wake[0], drain, sizeof(drain)) < 0 && errno != EINTR) break;
+      std::vector<std::pair<int, bool>> done;
+      {
+        std::lock_guard<std::mutex> lock(finished_mutex);
+        done.swap(finished);
+      }
+      for (auto [client, open] : done) {
+        if (open) {
+          connections[client].busy = false;
+        } else {
+          drop(client);
+        }
+      }
+    }
+
+    if (fds[0].revents) {
+      int client = accept(listener, nullptr, nullptr);
+      if (client < 0 && errno != EINTR) running = false;
+      if (client >= 0) {
+        std::lock_guard<std::mutex> lock(sockets_mutex_);
+        if (stop_) {
+          close(client);
+          running = false;
+        } else {
+          timeval timeout{kSendTimeoutSec, 0};
+          setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout,
+                     sizeof(timeout));
+          clients_.insert(client);
+          connections[client];
+        }
+      }
+    }
+
+    for (std::size_t i = 2; i < fds.size(); i++) {
+      if (!fds[i].revents) continue;
+      int client = fds[i].fd;
+      Connection& connection = connections[client];
+      char chunk[4096];
+      ssize_t count = read(client, chunk, sizeof(chunk));
+      if (count < 0 && errno == EINTR) continue;
+      if (count <= 0) {
+        drop(client);
+        continue;
+      }
+      connection.buffer.append(chunk, count);
+      std::size_t end = connection.buffer.rfind('\n');
+      if (end == std::string::npos) {
+        if (connection.buffer.size() > kMaxRequest) drop(client);
+        continue;
+      }
+      //  запросы одного соединения выполняются по порядку одной задачей,
+      //  соединение не читается, пока она не закончится
+      std::string requests = connection.buffer.substr(0, end + 1);
+      connection.buffer.erase(0, end + 1);
+      bool keep = connection.buffer.size() <= kMaxRequest;
+      connection.busy = true;
+      int notify = wake[1];
+      pool.Submit([this, client, requests, keep, notify, &finished_mutex,
+                   &finished] {
+        bool open = ServeRequests(client, requests) && keep;
+        {
+          std::lock_guard<std::mutex> lock(finished_mutex);
+          finished.emplace_back(client, open);
+        }
+        while (write(notify, "", 1) < 0 && errno == EINTR) {
+        }
+      });
+    }
+  }
+  //  прием мог прерваться и без Stop, открытые соединения закрываются
+  //  в любом случае, иначе пул не дождется их задач
+  Stop();
+  {
+    std::lock_guard<std::mutex> lock(sockets_mutex_);
+    listener_ = -1;
+  }
+  close(listener);
+  pool.Wait();
+  while (!connections.empty()) drop(connections.begin()->first);
+  close(wake[0]);
+  close(wake[1]);
+  unlink(path.c_str());
+  return true;
+}
+
+void MazeServer::Stop() {
+  std::lock_guard<std::mutex> lock(sockets_mutex_);
+  stop_ = true;
+  if (listener_ >= 0) shutdown(listener_, SHUT_RDWR);
+  for (int client : clients_) shutdown(client, SHUT_RDWR);
+}
+
+std::size_t MazeServer::GetMazeCount() {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return mazes_.size();
+}
+
+bool MazeServer::Request(const std::string& path, const std::string& request,
+                         std::string* response) {
+  sockaddr_un address;
+  if (!MakeAddress(path, &address)) return false;
+  int server = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server < 0) return false;
+  bool received = false;
+  if (connect(server, reinterpret_cast<sockaddr*>(&address),
+              sizeof(address)) == 0 &&
+      SendAll(server, request + "\n")) {
+    response->clear();
+    char chunk[4096];
+    ssize_t count;
+    while (!received && (count = read(server, chunk, sizeof(chunk))) != 0) {
+      if (count < 0 && errno == EINTR) continue;
+      if (count < 0) break;
+      auto* end = static_cast<const char*>(std::memchr(chunk, '\n', count));
+      response->append(chunk, end ? end - chunk : count);
+      received = end != nullptr;
+    }
+  }
+  close(server);
+  return received;
+}
+
+std::shared_ptr<MazeServer::Maze> MazeServer::Find(const std::string& name) {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto found = mazes_.find(name);
+  if (found == mazes_.end()) {
+    throw std::invalid_argument("Нет лабиринта: " + name);
+  }
+  return found->second;
+}
+
+void MazeServer::Publish(const std::string& name, std::unique_ptr<Maze> maze) {
+  //  анализатор держит рабочие буферы, у каждого потока пула они свои
+  thread_local MazeAnalyzer analyzer;
+  maze->stats = analyzer.Analyze(maze->model.GetRightBorders(),
+                                 maze->model.GetBottomBorders());
+  std::shared_ptr<Maze> published(std::move(maze));
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  mazes_[name].swap(published);
+  //  старая версия освобождается последним читателем, а если читателей
+  //  нет - здесь, после снятия блокировки
+  lock.unlock();
+}
+
+std::string MazeServer::Generate(const Args& args) {
+  if (args.size() < 3 || args.size() > 4) return kBadArgs;
+  int rows = ParseInt(args[1]), cols = ParseInt(args[2]);
+  if (rows <= 0 || cols <= 0) return kBadArgs;
+  if (static_cast<std::int64_t>(rows) * cols > kMaxCells) return kBadArgs;
+  GeneratorKind kind =
+      args.size() == 4 ? GeneratorFromName(args[3]) : GeneratorKind::kEller;
+  auto maze = std::make_unique<Maze>();
+  maze->model.GenerateMaze(rows, cols, kind);
+  Publish(args[0], std::move(maze));
+  return "ok " + args[1] + " " + args[2];
+}
+
+std::string MazeServer::Load(const Args& args) {
+  if (args.size() != 2) return kBadArgs;
+  auto maze = std::make_unique<Maze>();
+  std::string error;
+  if (!maze->model.TryReadFromFile(args[1], &error, kMaxCells)) {
+    return "error " + error;
+  }
+  std::string size = std::to_string(maze->model.GetMazeRows()) + " " +
+                     std::to_string(maze->model.GetMazeCols());
+  Publish(args[0], std::move(maze));
+  return "ok " + size;
+}
+
+std::string MazeServer::Solve(const Args& args) {
+  if (args.size() != 5) return kBadArgs;
+  Point start(ParseInt(args[1]), ParseInt(args[2]));
+  Point end(ParseInt(args[3]), ParseInt(args[4]));
+  std::shared_ptr<Maze> maze = Find(args[0]);
+  //  Model::GetPath пишет в рабочую матрицу модели, а этот поиск только
+  //  читает стены, поэтому один лабиринт решается в нескольких потоках
+  thread_local StepSolver solver;
+  solver.Start(maze->model.GetRightBorders(), maze->model.GetBottomBorders(),
+               start, end);
+  solver.Step(std::numeric_limits<std::size_t>::max());
+  std::vector<Point> path = solver.GetPath();
+  solver.Reset();
+  std::string response = "ok " + std::to_string(path.size());
+  for (const Point& point : path) {
+    response += ' ' + std::to_string(point.row) + ' ' +
+                std::to_string(point.col);
+  }
+  return response;
+}
+
+std::string MazeServer::Stats(const Args& args) {
+  if (args.empty()) {
+    return "ok " + std::to_string(GetMazeCount()) + " " +
+           std::to_string(GetRequests());
+  }
+  if (args.size() != 1) return kBadArgs;
+  std::shared_ptr<Maze> maze = Find(args[0]);
+  const MazeStats& stats = maze->stats;
+  std::ostringstream response;
+  response << "ok " << maze->model.GetMazeRows() << ' '
+           << maze->model.GetMazeCols() << ' ' << stats.diameter << ' '
+           << stats.dead_ends << ' ' << stats.corridors << ' '
+           << stats.junctions << ' ' << stats.isolated;
+  return response.str();
+}
+
+std::string MazeServer::Drop(const Args& args) {
+  if (args.size() != 1) return kBadArgs;
+  std::shared_ptr<Maze> dropped;
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto found = mazes_.find(args[0]);
+  if (found == mazes_.end()) return "error Нет лабиринта: " + args[0];
+  dropped.swap(found->second);
+  mazes_.erase(found);
+  lock.unlock();
+  return "ok";
+}
+
+bool MazeServer::ServeRequests(int client, const std::string& requests) {
+  std::size_t begin = 0, end;
+  while ((end = requests.find('\n', begin)) != std::string::npos) {
+    std::string request = requests.substr(begin, end - begin);
+    if (!request.empty() && request.back() == '\r') request.pop_back();
+    if (!SendAll(client, Handle(request) + "\n")) return false;
+    begin = end + 1;
+  }
+  return true;
+}
+
+}  // namespace s21
@@ -0,0 +1,136 @@
+#ifndef SRC_MODEL_S21_MAZE_SERVER_H_
+#define SRC_MODEL_S21_MAZE_SERVER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "s21_maze_stats.h"
+#include "s21_model.h"
+
+namespace s21 {
+
+/**
+ * Сервер, который держит именованные лабиринты в памяти между запросами и
+ * отвечает на них через локальный сокет Unix. Протокол строковый: запрос
+ * и ответ занимают по одной строке, ответ начинается с ok или error.
+ *   generate <имя> <строки> <столбцы> [алгоритм] -> ok <строки> <столбцы>
+ *   load <имя> <файл>                            -> ok <строки> <столбцы>
+ *   solve <имя> <r1> <c1> <r2> <c2>  -> ok <число точек> <r> <c> ...
+ *   stats <имя> -> ok <строки> <столбцы> <диаметр> <тупики> <коридоры>
+ *                  <развилки> <изолированные>
+ *   stats       -> ok <лабиринты> <запросы>
+ *   drop <имя>  -> ok
+ * Путь выдается от конечной точки к начальной, как в Model::GetPath.
+ * Соединения ждет один поток через poll и отдает пулу потоков только
+ * пришедшие строки запросов, поэтому простаивающие клиенты не занимают
+ * потоки пула. Опубликованный лабиринт больше не меняется: generate и
+ * load собирают новый лабиринт без блокировок и заменяют им старый,
+ * поэтому чтения одного лабиринта идут параллельно, а читатели старой
+ * версии дорабатывают с ней
+ */
+class MazeServer {
+ public:
+  /**
+   * Наибольшее число клеток лабиринта в generate и load: матрицы стен
+   * такого лабиринта занимают 128 МиБ, запрос больше отвергается, чтобы
+   * один клиент не исчерпал память сервера
+   */
+  static constexpr std::int64_t kMaxCells = 1 << 24;
+
+  /**
+   * Конструктор
+   * @param threads - число потоков обслуживания соединений, 0 - по числу
+   * ядер
+   */
+  explicit MazeServer(int threads = 0);
+  /**
+   * Деструктор, останавливает сервер
+   */
+  ~MazeServer();
+  MazeServer(const MazeServer&) = delete;
+  MazeServer& operator=(const MazeServer&) = delete;
+
+  /**
+   * Метод обработки одного запроса без сокета
+   * @param request - строка запроса
+   * @return - строка ответа без перевода строки
+   */
+  std::string Handle(const std::string& request);
+  /**
+   * Метод приема соединений, возвращается после Stop
+   * @param path - путь сокета, существующий файл заменяется
+   * @return - удалось ли открыть сокет
+   */
+  bool Serve(const std::string& path);
+  /**
+   * Метод остановки сервера из другого потока: новые соединения больше не
+   * принимаются, открытые закрываются
+   */
+  void Stop();
+  /**
+   * Метод получения числа лабиринтов в памяти
+   */
+  std::size_t GetMazeCount();
+  /**
+   * Метод получения числа обработанных запросов
+   */
+  std::uint64_t GetRequests() const { return requests_; }
+  /**
+   * Метод отправки одного запроса серверу
+   * @param path - путь сокета
+   * @param request - строка запроса
+   * @param response - строка ответа
+   * @return - удалось ли получить ответ
+   */
+  static bool Request(const std::string& path, const std::string& request,
+                      std::string* response);
+
+ protected:
+  /**
+   * Лабиринт в памяти сервера и его статистика, посчитанная при публикации
+   */
+  struct Maze {
+    Model model;
+    MazeStats stats;
+  };
+
+  /**
+   * Метод поиска лабиринта по имени, при отсутствии бросает
+   * std::invalid_argument
+   */
+  std::shared_ptr<Maze> Find(const std::string& name);
+  /**
+   * Метод публикации лабиринта под именем, старая версия заменяется
+   */
+  void Publish(const std::string& name, std::unique_ptr<Maze> maze);
+
+ private:
+  using Args = std::vector<std::string>;
+
+  std::string Generate(const Args& args);
+  std::string Load(const Args& args);
+  std::string Solve(const Args& args);
+  std::string Stats(const Args& args);
+  std::string Drop(const Args& args);
+  //  выполняет строки запросов и отправляет ответы, false - клиент отключен
+  bool ServeRequests(int client, const std::string& requests);
+
+  int threads_;
+  std::shared_mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<Maze>> mazes_;
+  std::mutex sockets_mutex_;
+  int listener_ = -1;
+  std::unordered_set<int> clients_;
+  bool stop_ = false;
+  std::atomic<std::uint64_t> requests_{0};
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_MAZE_SERVER_H_
@@ -0,0 +1,109 @@
+#include "s21_maze_stats.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr std::uint8_t kRight = 1;
+constexpr std::uint8_t kLeft = 2;
+constexpr std::uint8_t kUp = 4;
+constexpr std::uint8_t kDown = 8;
+
+//  число проходов по маске ходов
+constexpr int kDegree[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+}  // namespace
+
+void MazeAnalyzer::BuildMoves(const WallMatrix& right,
+                              const WallMatrix& bottom) {
+  rows_ = right.size();
+  cols_ = rows_ ? right[0].size() : 0;
+  moves_.assign(rows_ * cols_, 0);
+  for (int i = 0; i < rows_; i++) {
+    std::uint8_t* row = &moves_[i * cols_];
+    for (int j = 0; j < cols_ - 1; j++) {
+      if (!right[i][j]) {
+        row[j] |= kRight;
+        row[j + 1] |= kLeft;
+      }
+    }
+    if (i == rows_ - 1) break;
+    for (int j = 0; j < cols_; j++) {
+      if (!bottom[i][j]) {
+        row[j] |= kDown;
+        row[j + cols_] |= kUp;
+      }
+    }
+  }
+}
+
+DistanceStats MazeAnalyzer::Bfs(int from) {
+  DistanceStats stats;
+  dist_.assign(moves_.size(), -1);
+  queue_.resize(moves_.size());
+  std::size_t head = 0, tail = 0;
+  long long total = 0;
+  int farthest = from;
+  dist_[from] = 0;
+  queue_[tail++] = from;
+  while (head < tail) {
+    int cell = queue_[head++];
+    int d = dist_[cell];
+    total += d;
+    if (d > dist_[farthest]) farthest = cell;
+    std::uint8_t m = moves_[cell];
+    int next[4] = {cell + 1, cell - 1, cell - cols_, cell + cols_};
+    for (int k = 0; k < 4; k++) {
+      if ((m >> k) & 1 && dist_[next[k]] < 0) {
+        dist_[next[k]] = d + 1;
+        queue_[tail++] = next[k];
+      }
+    }
+  }
+  stats.reachable = static_cast<int>(tail);
+  stats.max_distance = dist_[farthest];
+  stats.farthest = Point(farthest / cols_, farthest % cols_);
+  stats.average_distance = static_cast<double>(total) / tail;
+  return stats;
+}
+
+MazeStats MazeAnalyzer::Analyze(const WallMatrix& right,
+                                const WallMatrix& bottom) {
+  MazeStats stats;
+  BuildMoves(right, bottom);
+  if (moves_.empty()) return stats;
+  for (std::uint8_t m : moves_) {
+    switch (kDegree[m]) {
+      case 0:
+        stats.isolated++;
+        break;
+      case 1:
+        stats.dead_ends++;
+        break;
+      case 2:
+        stats.corridors++;
+        break;
+      default:
+        stats.junctions++;
+    }
+  }
+  DistanceStats first = Bfs(0);
+  int start = first.farthest.row * cols_ + first.farthest.col;
+  DistanceStats second = Bfs(start);
+  stats.diameter = second.max_distance;
+  stats.diameter_start = first.farthest;
+  stats.diameter_end = second.farthest;
+  return stats;
+}
+
+DistanceStats MazeAnalyzer::Distances(const WallMatrix& right,
+                                      const WallMatrix& bottom,
+                                      const Point& from) {
+  BuildMoves(right, bottom);
+  if (from.row < 0 || from.col < 0 || from.row >= rows_ || from.col >= cols_) {
+    return DistanceStats();
+  }
+  return Bfs(from.row * cols_ + from.col);
+}
+
+}  // namespace s21
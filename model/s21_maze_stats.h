@@ -0,0 +1,108 @@
+#ifndef SRC_MODEL_S21_MAZE_STATS_H_
+#define SRC_MODEL_S21_MAZE_STATS_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "s21_memory.h"
+#include "s21_point.h"
+
+namespace s21 {
+
+/**
+ * Статистика лабиринта для оценки сложности
+ */
+struct MazeStats {
+  /**
+   * Длина самого длинного кратчайшего пути в шагах
+   */
+  int diameter = 0;
+  /**
+   * Концы самого длинного пути
+   */
+  Point diameter_start, diameter_end;
+  /**
+   * Число тупиков: клеток с одним проходом
+   */
+  int dead_ends = 0;
+  /**
+   * Число коридоров: клеток с двумя проходами
+   */
+  int corridors = 0;
+  /**
+   * Число развилок: клеток с тремя и более проходами
+   */
+  int junctions = 0;
+  /**
+   * Число изолированных клеток без проходов
+   */
+  int isolated = 0;
+};
+
+/**
+ * Статистика расстояний от одной клетки
+ */
+struct DistanceStats {
+  /**
+   * Число достижимых клеток, включая исходную
+   */
+  int reachable = 0;
+  /**
+   * Наибольшее расстояние
+   */
+  int max_distance = 0;
+  /**
+   * Самая далекая клетка
+   */
+  Point farthest;
+  /**
+   * Среднее расстояние до достижимых клеток
+   */
+  double average_distance = 0;
+};
+
+/**
+ * Подсчет статистики лабиринта за линейное время. Стены один раз
+ * переводятся в плоский массив масок ходов, дальше все проходы идут по
+ * непрерывной памяти. Рабочие буферы переиспользуются между лабиринтами
+ */
+class MazeAnalyzer {
+ public:
+  /**
+   * Метод подсчета статистики. Диаметр ищется двумя обходами в ширину:
+   * для идеального лабиринта он точный, для лабиринта с петлями это
+   * оценка снизу, для несвязного - диаметр компоненты клетки (0, 0)
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   */
+  MazeStats Analyze(const WallMatrix& right, const WallMatrix& bottom);
+  /**
+   * Метод подсчета статистики расстояний от клетки
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param from - исходная клетка
+   */
+  DistanceStats Distances(const WallMatrix& right, const WallMatrix& bottom,
+                          const Point& from);
+
+ protected:
+  /**
+   * Метод заполнения масок ходов за один проход по строкам
+   */
+  void BuildMoves(const WallMatrix& right, const WallMatrix& bottom);
+  /**
+   * Метод обхода в ширину по маскам ходов
+   * @param from - номер исходной клетки
+   */
+  DistanceStats Bfs(int from);
+
+ private:
+  int rows_ = 0;
+  int cols_ = 0;
+  std::vector<std::uint8_t> moves_;
+  std::vector<int> dist_;
+  std::vector<int> queue_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_MAZE_STATS_H_
@@ -0,0 +1,31 @@
+#include "s21_memory.h"
+
+#include <algorithm>
+
+namespace s21 {
+
+void CountingResource::Reset() {
+  usage_.allocations = 0;
+  usage_.peak = usage_.bytes;
+}
+
+void* CountingResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  void* pointer = upstream_->allocate(bytes, alignment);
+  usage_.allocations++;
+  usage_.bytes += bytes;
+  usage_.peak = std::max(usage_.peak, usage_.bytes);
+  return pointer;
+}
+
+void CountingResource::do_deallocate(void* pointer, std::size_t bytes,
+                                     std::size_t alignment) {
+  upstream_->deallocate(pointer, bytes, alignment);
+  usage_.bytes -= bytes;
+}
+
+bool CountingResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace s21
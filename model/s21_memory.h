@@ -0,0 +1,79 @@
+#ifndef SRC_MODEL_S21_MEMORY_H_
+#define SRC_MODEL_S21_MEMORY_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * Строка матрицы стен
+ */
+using WallRow = std::pmr::vector<int>;
+/**
+ * Матрица стен лабиринта. Строки берут память из того же источника, что и
+ * сама матрица, поэтому всю память лабиринта можно отдать арене
+ */
+using WallMatrix = std::pmr::vector<WallRow>;
+
+/**
+ * Статистика выделений памяти
+ */
+struct MemoryUsage {
+  /**
+   * Число выделений
+   */
+  std::size_t allocations = 0;
+  /**
+   * Занято байт сейчас
+   */
+  std::size_t bytes = 0;
+  /**
+   * Наибольшее число занятых байт
+   */
+  std::size_t peak = 0;
+};
+
+/**
+ * Источник памяти, который считает выделения и передает их дальше.
+ * Не потокобезопасен, как и std::pmr::monotonic_buffer_resource
+ */
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  /**
+   * Конструктор
+   * @param upstream - источник, из которого берется память
+   */
+  explicit CountingResource(std::pmr::memory_resource* upstream =
+                                std::pmr::get_default_resource())
+      : upstream_(upstream) {}
+  CountingResource(const CountingResource&) = delete;
+  CountingResource& operator=(const CountingResource&) = delete;
+  /**
+   * Метод получения источника, из которого берется память
+   */
+  std::pmr::memory_resource* GetUpstream() const { return upstream_; }
+  /**
+   * Метод получения статистики
+   */
+  const MemoryUsage& GetUsage() const { return usage_; }
+  /**
+   * Метод сброса числа выделений и пика до занятой сейчас памяти
+   */
+  void Reset();
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  std::pmr::memory_resource* upstream_;
+  MemoryUsage usage_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_MEMORY_H_
@@ -1,8 +1,19 @@
 #include "s21_model.h"
 
+#include "s21_trace.h"
+
 namespace s21 {
 
-Model::Model() {}
+Model::Model(std::pmr::memory_resource* resource)
+    : memory_(resource),
+      right_borders_(&memory_),
+      bottom_borders_(&memory_),
+      wave_matrix_(&memory_),
+      costs_(&memory_),
+      spare_right_(&memory_),
+      spare_bottom_(&memory_),
+      spare_costs_(&memory_),
+      components_(&memory_) {}
 
 void Model::SetMazeSize(int rows, int cols) {
   if (rows < 0 || cols < 0) {
@@ -16,14 +27,26 @@ int Model::GetMazeRows() { return rows_; }
 
 int Model::GetMazeCols() { return cols_; }
 
-std::vector<std::vector<int>>& Model::GetRightBorders() {
+WallMatrix& Model::GetRightBorders() {
   return right_borders_;
 }
 
-std::vector<std::vector<int>>& Model::GetBottomBorders() {
+WallMatrix& Model::GetBottomBorders() {
   return bottom_borders_;
 }
 
+void Model::SetBorders(WallMatrix right, WallMatrix bottom) {
+  BeginOperation();
+  SetMazeSize(static_cast<int>(right.size()),
+              right.empty() ? 0 : static_cast<int>(right[0].size()));
+  //  при другом источнике памяти матрицы копируются в источник модели
+  right_borders_ = std::move(right);
+  bottom_borders_ = std::move(bottom);
+  costs_.clear();
+  ResetCaches();
+  EndOperation(ModelOperation::kLoad);
+}
+
 int Model::GetRandomInt() {
   std::random_device rd;
   std::mt19937 gen(rd());
@@ -31,188 +54,290 @@ int Model::GetRandomInt() {
   return distribution(gen);
 }
 
-//  заполняем линию уникальными значениями множеств
-void Model::FillLineSet() {
-  for (int i = 0; i < cols_; i++) {
-    if (line_[i] == 0) {
-      line_[i] = count_;
-      count_++;
-    }
+//  генерация лабиринта
+void Model::GenerateMaze(int rows, int cols, GeneratorKind kind) {
+  S21_TRACE_SCOPE("Model::GenerateMaze");
+  BeginOperation();
+  SetMazeSize(rows, cols);
+  costs_.clear();
+  ResetCaches();
+  if (!generator_ || generator_kind_ != kind) {
+    std::random_device rd;
+    SeedGenerator(kind, (static_cast<std::uint64_t>(rd()) << 32) | rd());
   }
+  generator_->Generate(rows_, cols_, &right_borders_, &bottom_borders_);
+  EndOperation(ModelOperation::kGenerate);
 }
 
-//  объединение множеств с одинаковыми значениями
-void Model::MergeLineSet(int i, int element) {
-  int set = line_[i + 1];
-  for (int j = 0; j < cols_; j++) {
-    if (line_[j] == set) {
-      line_[j] = element;
-    }
+void Model::SeedGenerator(GeneratorKind kind, std::uint64_t seed) {
+  if (!generator_ || generator_kind_ != kind) {
+    generator_ = MakeGenerator(kind, seed);
+    generator_kind_ = kind;
+  } else {
+    generator_->Seed(seed);
   }
 }
 
-//  подсчет количества уникальных значений
-int Model::CountUniqueSet(int element) {
-  int count = 0;
-  for (int i = 0; i < cols_; i++) {
-    if (line_[i] == element) {
-      count++;
-    }
+void Model::ReadFromFile(std::string filename) {
+  std::string error;
+  if (!TryReadFromFile(filename, &error)) {
+    std::cerr << error << std::endl;
+    exit(1);
   }
-  return count;
 }
 
-//  подсчет горизонтальных линий
-int Model::CountHorizontalLines(int row, int element) {
-  int count = 0;
-  for (int i = 0; i < cols_; i++) {
-    if (line_[i] == element && bottom_borders_[row][i] == 0) {
-      count++;
+bool Model::TryReadFromFile(std::string filename, std::string* error,
+                            std::int64_t max_cells) {
+  S21_TRACE_SCOPE("Model::ReadFromFile");
+  BeginOperation();
+  int rows = 0, cols = 0;
+  MazeHash hash;
+  bool ok = false;
+  try {
+    std::unique_ptr<InputStream> file = OpenInput(filename);
+    if (file) {
+      TokenReader reader(file.get());
+      ok = ParseMaze(&reader, &rows, &cols, &hash, error, max_cells);
+    } else {
+      *error = "Не удалось открыть файл: " + filename;
     }
+  } catch (const std::runtime_error& exception) {
+    *error = exception.what();
   }
-  return count;
-}
 
-//  проверка горизонтальных линий
-void Model::CheckHorizontalLines(int row) {
-  for (int i = 0; i < cols_; i++) {
-    if (CountHorizontalLines(row, line_[i]) == 0) {
-      bottom_borders_[row][i] = 0;
-    }
+  //  прежний лабиринт заменяется только целиком и только верным
+  if (ok) {
+    rows_ = rows;
+    cols_ = cols;
+    right_borders_.swap(spare_right_);
+    bottom_borders_.swap(spare_bottom_);
+    costs_.swap(spare_costs_);
+    ResetCaches();
+    hash_ = hash.Finish(rows_, cols_);
+    hash_valid_ = true;
+    Validate();
   }
+  EndOperation(ModelOperation::kLoad);
+  return ok;
 }
 
-//  добавление горизонтальных линий
-void Model::AddHorizontalLine(int row) {
-  for (int i = 0; i < cols_; i++) {
-    int rand = GetRandomInt();
-    if (CountUniqueSet(line_[i]) != 1 || rand == 1) {
-      bottom_borders_[row][i] = 1;
-    }
+bool Model::ParseMaze(TokenReader* reader, int* rows, int* cols,
+                      MazeHash* hash, std::string* error,
+                      std::int64_t max_cells) {
+  if (!reader->NextInt(rows) || !reader->NextInt(cols)) {
+    *error = "Ошибка при считывании размеров массивов.";
+    return false;
+  }
+  if (*rows <= 0 || *cols <= 0) {
+    *error = "Размеры должны быть больше нуля.";
+    return false;
+  }
+  std::int64_t cells = static_cast<std::int64_t>(*rows) * *cols;
+  if (cells > max_cells) {
+    *error = "Слишком большой лабиринт.";
+    return false;
   }
-}
 
-//  добавление вертикальных линий
-void Model::AddVerticalLine(int row) {
-  for (int i = 0; i < cols_ - 1; i++) {
-    int rand = GetRandomInt();
-    if (rand == 1 || line_[i] == line_[i + 1]) {
-      right_borders_[row][i] = 1;
-    } else {
-      MergeLineSet(i, line_[i]);
+  //  хэш содержимого считается во время чтения, без второго прохода
+  for (WallMatrix* matrix : {&spare_right_, &spare_bottom_}) {
+    matrix->assign(*rows, WallRow(*cols));
+    for (auto& row : *matrix) {
+      for (int& element : row) {
+        reader->NextInt(&element);
+        hash->Add(element);
+      }
     }
   }
-  right_borders_[row][cols_ - 1] = 1;
+
+  //  необязательная матрица стоимостей, недочитанная матрица неверна
+  spare_costs_.clear();
+  int cost;
+  for (std::int64_t i = 0; i < cells && reader->NextInt(&cost); i++) {
+    if (spare_costs_.empty()) spare_costs_.assign(*rows, WallRow(*cols));
+    spare_costs_[i / *cols][i % *cols] = cost;
+  }
+  if (!spare_costs_.empty() &&
+      !WeightedSolver::IsValidCosts(spare_costs_, *rows, *cols)) {
+    *error = "Неверная матрица стоимостей клеток.";
+    return false;
+  }
+  return true;
 }
 
-//  добавление новой линии
-void Model::AddNewLine(int row) {
-  for (int i = 0; i < cols_; i++) {
-    if (bottom_borders_[row][i] == 1) {
-      line_[i] = 0;
+bool Model::SaveToFile(std::string filename, Compression compression) const {
+  S21_TRACE_SCOPE("Model::SaveToFile");
+  try {
+    std::unique_ptr<OutputStream> file = OpenOutput(filename, compression);
+    if (!file) return false;
+
+    TokenWriter writer(file.get());
+    writer.Write(rows_, ' ');
+    writer.Write(cols_, '\n');
+    for (const auto* matrix : {&right_borders_, &bottom_borders_, &costs_}) {
+      for (const auto& row : *matrix) {
+        for (int element : row) writer.Write(element, ' ');
+        writer.NewLine();
+      }
     }
+    return writer.Close();
+  } catch (const std::runtime_error& error) {
+    std::cerr << error.what() << std::endl;
+    return false;
   }
 }
 
-//  проверка последней линии
-void Model::CheckLastLine() {
-  for (int i = 0; i < cols_ - 1; i++) {
-    if (line_[i] != line_[i + 1]) {
-      right_borders_[rows_ - 1][i] = 0;
-      MergeLineSet(i, line_[i]);
-    }
+void Model::SetCosts(CostMatrix costs) {
+  if (!costs.empty() && !WeightedSolver::IsValidCosts(costs, rows_, cols_)) {
+    throw std::invalid_argument("Неверная матрица стоимостей клеток.");
   }
+  costs_ = std::move(costs);
 }
 
-//  добавление конечной линии
-void Model::AddLastLine() {
-  FillLineSet();
-  AddVerticalLine(rows_ - 1);
-  CheckLastLine();
+void Model::ReadFromArchive(const MazeArchive& archive, std::size_t id) {
+  WallMatrix right(&memory_), bottom(&memory_);
+  archive.Load(id, &right, &bottom);
+  SetBorders(std::move(right), std::move(bottom));
+  Validate();
 }
 
-//  генерация лабиринта
-void Model::GenerateMaze(int rows, int cols) {
-  SetMazeSize(rows, cols);
+long Model::AppendToArchive(std::string filename) const {
+  return MazeArchive::Append(filename, right_borders_, bottom_borders_);
+}
 
-  right_borders_.resize(rows_, std::vector<int>(cols_));
-  bottom_borders_.resize(rows_, std::vector<int>(cols_));
-  line_.resize(cols_, 0);
+MazeValidation Model::Validate() {
+  S21_TRACE_SCOPE("Model::Validate");
+  MazeValidation result = validator_.Validate(right_borders_, bottom_borders_);
+  components_.assign(result.component.begin(), result.component.end());
+  return result;
+}
 
-  for (int i = 0; i < rows_ - 1; i++) {
-    FillLineSet();
-    AddVerticalLine(i);
-    AddHorizontalLine(i);
-    CheckHorizontalLines(i);
-    AddNewLine(i);
-  }
-  AddLastLine();
-  line_.clear();
-  count_ = 1;
+int Model::RepairMaze() {
+  S21_TRACE_SCOPE("Model::RepairMaze");
+  int changed = validator_.Repair(&right_borders_, &bottom_borders_);
+  ResetCaches();
+  components_.assign(rows_ * cols_, 0);
+  return changed;
 }
 
-void Model::ReadFromFile(std::string filename) {
-  std::ifstream file(filename);
+void Model::ResetCaches() {
+  components_.clear();
+  field_.Clear();
+  hash_valid_ = false;
+}
 
-  if (!file.is_open()) {
-    std::cerr << "Не удалось открыть файл: " << filename << std::endl;
-    exit(1);
+std::uint64_t Model::GetHash() {
+  if (!hash_valid_) {
+    hash_ = MazeHash::Of(right_borders_, bottom_borders_);
+    hash_valid_ = true;
   }
+  return hash_;
+}
 
-  if (!(file >> rows_ >> cols_)) {
-    std::cerr << "Ошибка при считывании размеров массивов." << std::endl;
-    exit(1);
-  }
+bool Model::OpenSolveCache(std::string filename) {
+  auto cache = std::make_unique<SolveCache>();
+  if (!cache->Open(filename)) return false;
+  cache_ = std::move(cache);
+  return true;
+}
 
-  if (rows_ <= 0 || cols_ <= 0) {
-    std::cerr << "Размеры должны быть больше нуля." << std::endl;
-    exit(1);
+void Model::PrepareDistanceField() {
+  S21_TRACE_SCOPE("Model::PrepareDistanceField");
+  if (!HasDistanceField(start_)) {
+    field_.Build(right_borders_, bottom_borders_, start_);
   }
+}
 
-  right_borders_ =
-      std::vector<std::vector<int>>(rows_, std::vector<int>(cols_));
-
-  for (auto& row : right_borders_)
-    for (int& element : row) file >> element;
+void Model::ToggleRightWall(int row, int col) {
+  if (row < 0 || col < 0 || row >= rows_ || col >= cols_) {
+    throw std::invalid_argument("Неверные координаты стены.");
+  }
+  //  поле строится до правки, чтобы дальше чинить его по разнице
+  if (col < cols_ - 1) PrepareDistanceField();
+  right_borders_[row][col] = !right_borders_[row][col];
+  components_.clear();
+  hash_valid_ = false;
+  if (col < cols_ - 1) {
+    field_.Update(right_borders_, bottom_borders_, {row, col}, {row, col + 1});
+  }
+}
 
-  std::string emptyLine;
-  std::getline(file, emptyLine);
+void Model::ToggleBottomWall(int row, int col) {
+  if (row < 0 || col < 0 || row >= rows_ || col >= cols_) {
+    throw std::invalid_argument("Неверные координаты стены.");
+  }
+  if (row < rows_ - 1) PrepareDistanceField();
+  bottom_borders_[row][col] = !bottom_borders_[row][col];
+  components_.clear();
+  hash_valid_ = false;
+  if (row < rows_ - 1) {
+    field_.Update(right_borders_, bottom_borders_, {row, col}, {row + 1, col});
+  }
+}
 
-  bottom_borders_ =
-      std::vector<std::vector<int>>(rows_, std::vector<int>(cols_));
-  for (auto& row : bottom_borders_)
-    for (int& element : row) file >> element;
+int Model::GetDistance(const Point& point) {
+  return GetDistanceField().GetDistance(point);
+}
 
-  file.close();
+const DistanceField& Model::GetDistanceField() {
+  PrepareDistanceField();
+  return field_;
 }
 
 void Model::ClearData() {
   right_borders_.clear();
   bottom_borders_.clear();
   wave_matrix_.clear();
-  line_.clear();
+  costs_.clear();
+  ResetCaches();
   rows_ = 0;
   cols_ = 0;
   count_ = 1;
 }
 
 std::vector<Point> Model::GetPath(const Point& start, const Point& end) {
+  S21_TRACE_SCOPE("Model::GetPath");
   if (start.row < 0 || start.col < 0 || end.row < 0 || end.col < 0) {
     std::cerr << "Неверные координаты точек." << std::endl;
     exit(1);
   }
+  std::vector<Point> path;
+  if (cache_ && cache_->FindPath(GetHash(), start, end, &path)) return path;
+  path = SolvePath(start, end);
+  if (cache_) cache_->StorePath(GetHash(), start, end, path);
+  return path;
+}
+
+std::vector<Point> Model::SolvePath(const Point& start, const Point& end) {
+  S21_TRACE_SCOPE("Model::SolvePath");
+  if (!components_.empty() && components_[start.row * cols_ + start.col] !=
+                                  components_[end.row * cols_ + end.col]) {
+    return {};
+  }
+  //  после правок стен путь от начальной точки берется из поля расстояний
+  if (HasDistanceField(start)) {
+    return field_.GetPath(right_borders_, bottom_borders_, end);
+  }
+  BeginOperation();
   count_ = 1;
-  wave_matrix_.clear();
-  wave_matrix_.resize(rows_, std::vector<int>(cols_, 0));
+  //  строки переиспользуются, чтобы повторный поиск не брал память у арены
+  wave_matrix_.resize(rows_);
+  for (auto& row : wave_matrix_) row.assign(cols_, 0);
   wave_matrix_[start.row][start.col] = count_;
   bool hasPath = true;
   while (wave_matrix_[end.row][end.col] == 0 && (hasPath = GetWave())) {
     count_++;
   }
-  return FindPath(end, hasPath);
+  std::vector<Point> path = FindPath(end, hasPath);
+  EndOperation(ModelOperation::kSolve);
+  return path;
+}
+
+CompactPath Model::GetCompactPath(const Point& start, const Point& end) {
+  return CompactPath::Encode(GetPath(start, end));
 }
 
 bool Model::GetWave() {
+  S21_TRACE_SCOPE("Model::GetWave");
   bool flag = false;
 
   for (int i = 0; i < rows_; ++i) {
@@ -240,6 +365,7 @@ bool Model::GetWave() {
 }
 
 std::vector<Point> Model::FindPath(Point pos, bool hasPath) const {
+  S21_TRACE_SCOPE("Model::FindPath");
   std::vector<Point> path;
   int count = count_;
 
@@ -1,44 +1,48 @@
 #ifndef SRC_MODEL_S21_MODEL_H_
 #define SRC_MODEL_S21_MODEL_H_
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <queue>
 #include <random>
 #include <vector>
 
+#include "s21_compact_path.h"
+#include "s21_distance_field.h"
+#include "s21_generator.h"
+#include "s21_maze_archive.h"
+#include "s21_maze_hash.h"
+#include "s21_maze_io.h"
+#include "s21_memory.h"
+#include "s21_point.h"
+#include "s21_solve_cache.h"
+#include "s21_validator.h"
+#include "s21_weighted_solver.h"
+
 namespace s21 {
 
 /**
- * Структура для хранения координат
+ * Операция модели, для которой считается память
  */
-struct Point {
-  /**
-   * Координата по оси Х
-   */
-  int row;
-  /**
-   * Координата по оси Y
-   */
-  int col;
-  /**
-   * Конструктор
-   */
-  Point() : row(0), col(0) {}
-  /**
-   * Конструктор
-   * @param row - координата по оси Х
-   * @param col - координата по оси Y
-   */
-  Point(int row, int col) : row(row), col(col) {}
+enum class ModelOperation {
+  kGenerate,  //  генерация лабиринта
+  kLoad,      //  чтение из файла или архива, установка матриц стен
+  kSolve      //  поиск пути
 };
 
 class Model {
  public:
   /**
    *  Конструктор модели
+   * @param resource - источник памяти для матриц лабиринта, например арена
+   * std::pmr::monotonic_buffer_resource на одно задание. Источник должен
+   * жить дольше модели
    */
-  Model();
+  explicit Model(std::pmr::memory_resource* resource =
+                     std::pmr::get_default_resource());
   /**
    * Создание лабиринта с параметрами ширины и высоты
    * @param rows - ширина лабиринта
@@ -61,23 +65,85 @@ class Model {
    * Метод получения матрицы заполнения лабиринта стенами справа
    * @return - матрица заполнения лабиринта стенами справа
    */
-  std::vector<std::vector<int>>& GetRightBorders();
+  WallMatrix& GetRightBorders();
   /**
    * Метод получения матрицы заполнения лабиринта снизу
    * @return - матрица заполнения лабиринта стенами снизу
    */
-  std::vector<std::vector<int>>& GetBottomBorders();
+  WallMatrix& GetBottomBorders();
+  /**
+   * Метод установки матриц стен, размеры лабиринта берутся из матриц
+   * @param right - матрица заполнения лабиринта стенами справа
+   * @param bottom - матрица заполнения лабиринта стенами снизу
+   */
+  void SetBorders(WallMatrix right, WallMatrix bottom);
   /**
    * Метод генерации случайного лабиринта с параметрами ширины и высоты
    * @param rows - ширина лабиринта
    * @param cols - высота лабиринта
+   * @param kind - алгоритм генерации
+   */
+  void GenerateMaze(int rows, int cols,
+                    GeneratorKind kind = GeneratorKind::kEller);
+  /**
+   * Метод установки зерна генератора, чтобы получать одинаковые лабиринты
+   * @param kind - алгоритм генерации
+   * @param seed - зерно
+   */
+  void SeedGenerator(GeneratorKind kind, std::uint64_t seed);
+  /**
+   * Метод установки стоимостей входа в клетки. Стоимости сбрасываются при
+   * смене лабиринта
+   * @param costs - матрица стоимостей или пустая матрица для единичных
+   * стоимостей
    */
-  void GenerateMaze(int rows, int cols);
+  void SetCosts(CostMatrix costs);
   /**
-   * Метод считывания лабиринта из файла
+   * Метод проверки, заданы ли стоимости клеток
+   */
+  bool HasCosts() const { return !costs_.empty(); }
+  /**
+   * Метод получения матрицы стоимостей клеток
+   */
+  const CostMatrix& GetCosts() const { return costs_; }
+  /**
+   * Метод считывания лабиринта из файла.
+   * После матриц стен может идти матрица стоимостей входа в клетки
    * @param filename - имя файла
    */
   void ReadFromFile(std::string filename);
+  /**
+   * Метод считывания лабиринта из файла без завершения программы при
+   * ошибке, для долго работающих процессов. При ошибке модель не меняется
+   * @param filename - имя файла
+   * @param error - текст ошибки, если считать не удалось
+   * @param max_cells - наибольшее допустимое число клеток, лабиринт больше
+   * отвергается до выделения памяти под матрицы
+   * @return - успешно ли считывание
+   */
+  bool TryReadFromFile(
+      std::string filename, std::string* error,
+      std::int64_t max_cells = std::numeric_limits<std::int64_t>::max());
+  /**
+   * Метод сохранения лабиринта в файл в формате ReadFromFile
+   * @param filename - имя файла
+   * @param compression - сжатие файла
+   * @return - успешно ли сохранение
+   */
+  bool SaveToFile(std::string filename,
+                  Compression compression = Compression::kNone) const;
+  /**
+   * Метод чтения лабиринта из открытого архива
+   * @param archive - архив лабиринтов
+   * @param id - номер лабиринта в архиве
+   */
+  void ReadFromArchive(const MazeArchive& archive, std::size_t id);
+  /**
+   * Метод добавления лабиринта в конец архива
+   * @param filename - имя файла архива
+   * @return - номер лабиринта в архиве или -1 при ошибке
+   */
+  long AppendToArchive(std::string filename) const;
   /**
    * Метод установки координат начальной точки для поиска пути
    * @param start - координаты начальной точки
@@ -106,60 +172,97 @@ class Model {
    */
   std::vector<Point> GetPath(const Point& start, const Point& end);
   /**
-   * Метод очистки лабиринта
+   * Метод получения хэша содержимого лабиринта MazeHash. При чтении из
+   * файла хэш считается во время разбора, после других изменений - при
+   * первом запросе
    */
-  void ClearData();
-
- protected:
+  std::uint64_t GetHash();
+  /**
+   * Метод открытия кэша путей в файле. С открытым кэшем GetPath сначала
+   * ищет путь в кэше по хэшу лабиринта и точкам
+   * @param filename - имя файла кэша
+   * @return - удалось ли открыть кэш
+   */
+  bool OpenSolveCache(std::string filename);
+  /**
+   * Метод получения кэша путей
+   * @return - кэш или nullptr, если кэш не открыт
+   */
+  SolveCache* GetSolveCache() { return cache_.get(); }
+  /**
+   * Метод получения пути в компактном виде
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь из конечной точки в начальную сериями ходов
+   */
+  CompactPath GetCompactPath(const Point& start, const Point& end);
   /**
-   * Метод заполнения лабиринта стенами
+   * Метод переключения стены справа от клетки. Поле расстояний от текущей
+   * начальной точки чинится только в затронутой области
+   * @param row - индекс строки
+   * @param col - индекс столбца
    */
-  void FillLineSet();
+  void ToggleRightWall(int row, int col);
   /**
-   * Метод объединения множеств с одинаковыми значениями
-   * @param i - индекс линии
-   * @param element - значение
+   * Метод переключения стены снизу от клетки
+   * @param row - индекс строки
+   * @param col - индекс столбца
    */
-  void MergeLineSet(int i, int element);
+  void ToggleBottomWall(int row, int col);
   /**
-   * Метод подсчет количества уникальных значений в множестве
-   * @param element - значение множества
+   * Метод получения расстояния от начальной точки до клетки
+   * @param point - координаты клетки
+   * @return - расстояние или DistanceField::kUnreachable
    */
-  int CountUniqueSet(int element);
+  int GetDistance(const Point& point);
   /**
-   * Метод подсчета количества множеств с определенным значением в линии
-   * @param row - индекс линии
-   * @param element - значение
+   * Метод получения поля расстояний от начальной точки
    */
-  int CountHorizontalLines(int row, int element);
+  const DistanceField& GetDistanceField();
   /**
-   * Метод проверки горизонтальных линий
-   * @param row - индекс линии
+   * Метод проверки, построено ли поле расстояний от точки. Такое поле
+   * чинится при правках стен, и путь из точки берется из него
+   * @param source - координаты точки
    */
-  void CheckHorizontalLines(int row);
+  bool HasDistanceField(const Point& source) const {
+    return field_.IsValid() && field_.GetSource().row == source.row &&
+           field_.GetSource().col == source.col;
+  }
   /**
-   * Метод добавления стен снизу в линию
-   * @param row - индекс линии
+   * Метод проверки лабиринта: тип, петли и компоненты связности.
+   * Компоненты запоминаются, и поиск пути между разными компонентами
+   * завершается сразу
+   * @return - результат проверки
    */
-  void AddHorizontalLine(int row);
+  MazeValidation Validate();
   /**
-   * Метод добавления стен справа в линию
-   * @param row - индекс линии
+   * Метод превращения лабиринта в идеальный
+   * @return - число измененных стен
    */
-  void AddVerticalLine(int row);
+  int RepairMaze();
+  /**
+   * Метод очистки лабиринта
+   */
+  void ClearData();
   /**
-   * Метод добавления новой линии на основе предыдущей
-   * @param row - индекс линии
+   * Метод получения источника памяти модели
    */
-  void AddNewLine(int row);
+  std::pmr::memory_resource* GetMemoryResource() { return &memory_; }
   /**
-   * Метод проверки последей линии
+   * Метод получения памяти, занятой моделью сейчас
    */
-  void CheckLastLine();
+  const MemoryUsage& GetMemoryUsage() const { return memory_.GetUsage(); }
   /**
-   * Метод добавления конечной линии
+   * Метод получения памяти последней операции: число выделений за
+   * операцию, занятая после нее память и пик во время операции вместе с
+   * уже занятой до нее
+   * @param operation - операция
    */
-  void AddLastLine();
+  const MemoryUsage& GetMemoryUsage(ModelOperation operation) const {
+    return usage_[static_cast<int>(operation)];
+  }
+
+ protected:
   /**
    * Метод поиска пути
    * @param pos - координаты начальной точки
@@ -167,19 +270,69 @@ class Model {
    * @return - путь состоящий из координат
    */
   std::vector<Point> FindPath(Point pos, bool hasPath) const;
+  /**
+   * Метод поиска пути без кэша путей
+   */
+  std::vector<Point> SolvePath(const Point& start, const Point& end);
   /**
    * Метод проверки пути
    */
   bool GetWave();
+  /**
+   * Метод построения поля расстояний, если оно построено не от start_
+   */
+  void PrepareDistanceField();
+  /**
+   * Метод разбора лабиринта в запасные матрицы
+   * @param reader - поток чисел файла
+   * @param rows - число строк
+   * @param cols - число столбцов
+   * @param hash - хэш стен, считается во время разбора
+   * @param error - текст ошибки
+   * @param max_cells - наибольшее допустимое число клеток
+   * @return - верен ли лабиринт
+   */
+  bool ParseMaze(TokenReader* reader, int* rows, int* cols, MazeHash* hash,
+                 std::string* error, std::int64_t max_cells);
+  /**
+   * Метод сброса кэшей, зависящих от стен лабиринта
+   */
+  void ResetCaches();
+  /**
+   * Метод начала подсчета памяти операции
+   */
+  void BeginOperation() { memory_.Reset(); }
+  /**
+   * Метод сохранения памяти операции
+   * @param operation - операция
+   */
+  void EndOperation(ModelOperation operation) {
+    usage_[static_cast<int>(operation)] = memory_.GetUsage();
+  }
 
  private:
+  CountingResource memory_;
+  MemoryUsage usage_[3];
   int rows_ = 0;
   int cols_ = 0;
   int count_ = 1;
-  std::vector<int> line_;
   Point start_;
   Point end_;
-  std::vector<std::vector<int>> right_borders_, bottom_borders_, wave_matrix_;
+  WallMatrix right_borders_, bottom_borders_, wave_matrix_;
+  CostMatrix costs_;
+  //  матрицы, в которые читается файл; после успешного чтения они
+  //  меняются местами с текущими, и память прежнего лабиринта
+  //  переиспользуется при следующем чтении
+  WallMatrix spare_right_, spare_bottom_;
+  CostMatrix spare_costs_;
+  std::pmr::vector<int> components_;
+  MazeValidator validator_;
+  DistanceField field_;
+  GeneratorKind generator_kind_ = GeneratorKind::kEller;
+  std::unique_ptr<MazeGenerator> generator_;
+  std::uint64_t hash_ = 0;
+  bool hash_valid_ = false;
+  std::unique_ptr<SolveCache> cache_;
 };
 
 }  // namespace s21
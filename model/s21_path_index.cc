@@ -0,0 +1,458 @@
+#include "s21_path_index.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr char kMagic[8] = {'S', '2', '1', 'H', 'P', 'A', '\0', '\0'};
+constexpr std::uint32_t kVersion = 1;
+
+struct Header {
+  char magic[8];
+  std::uint32_t version;
+  std::int32_t rows;
+  std::int32_t cols;
+  std::int32_t cluster;
+  std::uint64_t fingerprint;
+  std::uint64_t nodes;
+  std::uint64_t edges;
+};
+
+//  заголовок читается из файла, поэтому числа в нем сначала проверяются
+//  по диапазону, а оценки считаются в 64 битах без переполнения
+bool IsValidSize(const Header& header, int rows, int cols) {
+  if (header.cluster < 2 || header.cluster > std::max({2, rows, cols})) {
+    return false;
+  }
+  std::int64_t cells = static_cast<std::int64_t>(rows) * cols;
+  if (header.nodes > static_cast<std::uint64_t>(cells)) return false;
+  //  у вершины не больше 4 * cluster + 4 ребер, сравнение делением
+  std::int64_t per_node = 4 * static_cast<std::int64_t>(header.cluster) + 4;
+  std::uint64_t min_nodes = header.edges / per_node +
+                            (header.edges % per_node != 0 ? 1 : 0);
+  return min_nodes <= header.nodes;
+}
+
+//  метка вершины при поиске по абстрактному графу
+struct Label {
+  int dist;
+  int parent;
+};
+
+//  у пустого вектора data() может быть нулевым, его не передают в fwrite
+template <class T>
+bool WriteArray(std::FILE* file, const std::vector<T>& data) {
+  return data.empty() ||
+         std::fwrite(data.data(), sizeof(T), data.size(), file) == data.size();
+}
+
+template <class T>
+bool ReadArray(std::FILE* file, std::size_t count, std::vector<T>* data) {
+  data->resize(count);
+  return count == 0 ||
+         std::fread(data->data(), sizeof(T), count, file) == count;
+}
+
+}  // namespace
+
+void PathIndex::Build(const WallMatrix& right, const WallMatrix& bottom,
+                      int cluster, int threads) {
+  if (cluster < 2) {
+    throw std::invalid_argument("Размер кластера должен быть не меньше 2.");
+  }
+  Clear();
+  rows_ = right.size();
+  cols_ = rows_ ? right[0].size() : 0;
+  if (!rows_ || !cols_) return;
+  //  кластер больше лабиринта делит его так же, как кластер в его размер
+  cluster = std::min(cluster, std::max({2, rows_, cols_}));
+  cluster_ = cluster;
+  cluster_cols_ = (cols_ + cluster - 1) / cluster;
+  int clusters = ((rows_ + cluster - 1) / cluster) * cluster_cols_;
+  fingerprint_ = Fingerprint(right, bottom);
+  ThreadPool pool(threads);
+
+  //  вершины графа, по возрастанию номера клетки внутри каждого кластера
+  std::vector<std::vector<std::int32_t>> entrances(clusters);
+  pool.ParallelFor(clusters, [&](std::size_t id, int) {
+    FindEntrances(right, bottom, id, &entrances[id]);
+  });
+  cluster_offsets_.assign(clusters + 1, 0);
+  for (int i = 0; i < clusters; i++) {
+    cluster_offsets_[i + 1] = cluster_offsets_[i] + entrances[i].size();
+  }
+  nodes_.reserve(cluster_offsets_.back());
+  for (auto& cells : entrances) {
+    nodes_.insert(nodes_.end(), cells.begin(), cells.end());
+    std::vector<std::int32_t>().swap(cells);
+  }
+
+  //  ребра внутри кластеров и через их границы
+  std::vector<std::vector<Edge>> edges(clusters);
+  std::vector<std::vector<int>> scratch(pool.Size());
+  edge_offsets_.assign(nodes_.size() + 1, 0);
+  pool.ParallelFor(clusters, [&](std::size_t id, int worker) {
+    ConnectCluster(right, bottom, id, &scratch[worker], &edges[id],
+                   &edge_offsets_);
+  });
+  for (std::size_t i = 0; i < nodes_.size(); i++) {
+    edge_offsets_[i + 1] += edge_offsets_[i];
+  }
+  edges_.reserve(edge_offsets_.back());
+  for (auto& cluster_edges : edges) {
+    edges_.insert(edges_.end(), cluster_edges.begin(), cluster_edges.end());
+    std::vector<Edge>().swap(cluster_edges);
+  }
+}
+
+void PathIndex::Clear() {
+  rows_ = 0;
+  cols_ = 0;
+  cluster_ = 0;
+  cluster_cols_ = 0;
+  fingerprint_ = 0;
+  cluster_offsets_.clear();
+  nodes_.clear();
+  edge_offsets_.clear();
+  edges_.clear();
+}
+
+bool PathIndex::Save(const std::string& filename) const {
+  if (!IsValid()) return false;
+  std::FILE* file = std::fopen(filename.c_str(), "wb");
+  if (!file) return false;
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.rows = rows_;
+  header.cols = cols_;
+  header.cluster = cluster_;
+  header.fingerprint = fingerprint_;
+  header.nodes = nodes_.size();
+  header.edges = edges_.size();
+  bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+            WriteArray(file, cluster_offsets_) && WriteArray(file, nodes_) &&
+            WriteArray(file, edge_offsets_) && WriteArray(file, edges_);
+  return std::fclose(file) == 0 && ok;
+}
+
+bool PathIndex::Load(const std::string& filename, const WallMatrix& right,
+                     const WallMatrix& bottom) {
+  Clear();
+  std::FILE* file = std::fopen(filename.c_str(), "rb");
+  if (!file) return false;
+  Header header{};
+  int rows = right.size();
+  int cols = rows ? right[0].size() : 0;
+  bool ok = std::fread(&header, sizeof(header), 1, file) == 1 &&
+            std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+            header.version == kVersion && header.rows == rows &&
+            header.cols == cols && rows && cols &&
+            IsValidSize(header, rows, cols) &&
+            header.fingerprint == Fingerprint(right, bottom);
+  if (ok) {
+    rows_ = rows;
+    cols_ = cols;
+    cluster_ = header.cluster;
+    cluster_cols_ = (cols_ + cluster_ - 1) / cluster_;
+    fingerprint_ = header.fingerprint;
+    std::size_t clusters =
+        static_cast<std::size_t>((rows_ + cluster_ - 1) / cluster_) *
+        cluster_cols_;
+    ok = ReadArray(file, clusters + 1, &cluster_offsets_) &&
+         ReadArray(file, header.nodes, &nodes_) &&
+         ReadArray(file, header.nodes + 1, &edge_offsets_) &&
+         ReadArray(file, header.edges, &edges_) && IsConsistent();
+  }
+  std::fclose(file);
+  if (!ok) Clear();
+  return ok;
+}
+
+bool PathIndex::IsConsistent() const {
+  //  индекс подгружается автоматически рядом с лабиринтом, поэтому
+  //  поврежденный файл не должен приводить к выходу за границы массивов
+  std::size_t clusters = cluster_offsets_.size() - 1;
+  if (cluster_offsets_[0] != 0 || cluster_offsets_[clusters] != nodes_.size()) {
+    return false;
+  }
+  std::int64_t cells = static_cast<std::int64_t>(rows_) * cols_;
+  for (std::size_t cluster = 0; cluster < clusters; cluster++) {
+    std::uint32_t begin = cluster_offsets_[cluster];
+    std::uint32_t end = cluster_offsets_[cluster + 1];
+    if (begin > end) return false;
+    for (std::uint32_t i = begin; i < end; i++) {
+      if (nodes_[i] < 0 || nodes_[i] >= cells ||
+          ClusterOf(nodes_[i]) != static_cast<int>(cluster) ||
+          (i > begin && nodes_[i] <= nodes_[i - 1])) {
+        return false;
+      }
+    }
+  }
+  if (edge_offsets_[0] != 0 || edge_offsets_.back() != edges_.size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i + 1 < edge_offsets_.size(); i++) {
+    if (edge_offsets_[i] > edge_offsets_[i + 1]) return false;
+  }
+  for (const Edge& edge : edges_) {
+    if (edge.to < 0 || static_cast<std::size_t>(edge.to) >= nodes_.size() ||
+        edge.cost < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string PathIndex::FileFor(const std::string& maze_filename) {
+  return maze_filename + ".hpa";
+}
+
+std::uint64_t PathIndex::Fingerprint(const WallMatrix& right,
+                                     const WallMatrix& bottom) {
+  //  FNV-1a по размерам и парам стен клеток
+  constexpr std::uint64_t kPrime = 1099511628211ull;
+  std::uint64_t hash = 14695981039346656037ull;
+  hash = (hash ^ right.size()) * kPrime;
+  hash = (hash ^ (right.empty() ? 0 : right[0].size())) * kPrime;
+  for (std::size_t i = 0; i < right.size(); i++) {
+    for (std::size_t j = 0; j < right[i].size(); j++) {
+      hash = (hash ^ ((right[i][j] != 0) | (bottom[i][j] != 0) << 1)) * kPrime;
+    }
+  }
+  return hash;
+}
+
+std::vector<Point> PathIndex::GetPath(const WallMatrix& right,
+                                      const WallMatrix& bottom,
+                                      const Point& start,
+                                      const Point& end) const {
+  if (!IsValid()) return {};
+  int source = start.row * cols_ + start.col;
+  int target = end.row * cols_ + end.col;
+  if (source == target) return {end};
+
+  //  начальная и конечная точки подключаются к вершинам своих кластеров
+  int source_cluster = ClusterOf(source), target_cluster = ClusterOf(target);
+  Bounds source_bounds = GetBounds(source_cluster);
+  Bounds target_bounds = GetBounds(target_cluster);
+  std::vector<int> from_source, to_target;
+  LocalBfs(right, bottom, source_bounds, source, &from_source);
+  LocalBfs(right, bottom, target_bounds, target, &to_target);
+  auto local = [](const Bounds& bounds, int cols, int cell) {
+    return (cell / cols - bounds.row) * bounds.cols + cell % cols - bounds.col;
+  };
+
+  //  A* по абстрактному графу с манхэттенским расстоянием в качестве оценки
+  const int kSource = nodes_.size(), kTarget = kSource + 1;
+  auto cell_of = [&](int node) {
+    return node == kSource ? source : node == kTarget ? target : nodes_[node];
+  };
+  auto estimate = [&](int node) {
+    int cell = cell_of(node);
+    return std::abs(cell / cols_ - end.row) + std::abs(cell % cols_ - end.col);
+  };
+  using Item = std::pair<int, int>;
+  std::priority_queue<Item, std::vector<Item>, std::greater<Item>> queue;
+  std::unordered_map<int, Label> labels;
+  auto relax = [&](int from, int to, int cost) {
+    int dist = labels[from].dist + cost;
+    auto found = labels.find(to);
+    if (found != labels.end() && found->second.dist <= dist) return;
+    labels[to] = {dist, from};
+    queue.push({dist + estimate(to), to});
+  };
+  labels[kSource] = {0, -1};
+  queue.push({estimate(kSource), kSource});
+  while (!queue.empty()) {
+    auto [priority, node] = queue.top();
+    queue.pop();
+    if (priority > labels[node].dist + estimate(node)) continue;
+    if (node == kTarget) break;
+    if (node == kSource) {
+      for (std::uint32_t i = cluster_offsets_[source_cluster];
+           i < cluster_offsets_[source_cluster + 1]; i++) {
+        int dist = from_source[local(source_bounds, cols_, nodes_[i])];
+        if (dist >= 0) relax(kSource, i, dist);
+      }
+      if (source_cluster == target_cluster) {
+        int dist = from_source[local(source_bounds, cols_, target)];
+        if (dist >= 0) relax(kSource, kTarget, dist);
+      }
+      continue;
+    }
+    for (std::uint64_t i = edge_offsets_[node]; i < edge_offsets_[node + 1];
+         i++) {
+      relax(node, edges_[i].to, edges_[i].cost);
+    }
+    if (ClusterOf(nodes_[node]) == target_cluster) {
+      int dist = to_target[local(target_bounds, cols_, nodes_[node])];
+      if (dist >= 0) relax(node, kTarget, dist);
+    }
+  }
+  if (!labels.count(kTarget)) return {};
+
+  //  уточнение пути внутри кластеров, путь идет от конечной точки
+  std::vector<Point> path;
+  path.reserve(labels[kTarget].dist + 1);
+  path.push_back(end);
+  for (int node = kTarget; node != kSource; node = labels[node].parent) {
+    AppendSegment(right, bottom, cell_of(node), cell_of(labels[node].parent),
+                  &path);
+  }
+  return path;
+}
+
+PathIndex::Bounds PathIndex::GetBounds(int cluster) const {
+  Bounds bounds;
+  bounds.row = cluster / cluster_cols_ * cluster_;
+  bounds.col = cluster % cluster_cols_ * cluster_;
+  bounds.rows = std::min(cluster_, rows_ - bounds.row);
+  bounds.cols = std::min(cluster_, cols_ - bounds.col);
+  return bounds;
+}
+
+int PathIndex::ClusterOf(int cell) const {
+  return cell / cols_ / cluster_ * cluster_cols_ + cell % cols_ / cluster_;
+}
+
+int PathIndex::FindNode(int cell) const {
+  int cluster = ClusterOf(cell);
+  auto begin = nodes_.begin() + cluster_offsets_[cluster];
+  auto end = nodes_.begin() + cluster_offsets_[cluster + 1];
+  auto found = std::lower_bound(begin, end, cell);
+  return found != end && *found == cell ? found - nodes_.begin() : -1;
+}
+
+int PathIndex::Neighbors(const WallMatrix& right,
+                         const WallMatrix& bottom, int cell,
+                         int (&neighbors)[4]) const {
+  int row = cell / cols_, col = cell % cols_, count = 0;
+  if (col < cols_ - 1 && !right[row][col]) neighbors[count++] = cell + 1;
+  if (col > 0 && !right[row][col - 1]) neighbors[count++] = cell - 1;
+  if (row > 0 && !bottom[row - 1][col]) neighbors[count++] = cell - cols_;
+  if (row < rows_ - 1 && !bottom[row][col]) neighbors[count++] = cell + cols_;
+  return count;
+}
+
+void PathIndex::FindEntrances(const WallMatrix& right, const WallMatrix& bottom,
+                              int cluster,
+                              std::vector<std::int32_t>* cells) const {
+  Bounds bounds = GetBounds(cluster);
+  int neighbors[4];
+  for (int i = 0; i < bounds.rows; i++) {
+    bool edge_row = i == 0 || i == bounds.rows - 1;
+    for (int j = 0; j < bounds.cols; j += edge_row ? 1 : bounds.cols - 1) {
+      int cell = (bounds.row + i) * cols_ + bounds.col + j;
+      for (int k = 0, n = Neighbors(right, bottom, cell, neighbors); k < n;
+           k++) {
+        if (ClusterOf(neighbors[k]) != cluster) {
+          cells->push_back(cell);
+          break;
+        }
+      }
+      if (bounds.cols == 1) break;
+    }
+  }
+  std::sort(cells->begin(), cells->end());
+  cells->erase(std::unique(cells->begin(), cells->end()), cells->end());
+}
+
+void PathIndex::ConnectCluster(const WallMatrix& right,
+                               const WallMatrix& bottom, int cluster,
+                               std::vector<int>* dist, std::vector<Edge>* edges,
+                               std::vector<std::uint64_t>* degrees) const {
+  Bounds bounds = GetBounds(cluster);
+  std::uint32_t begin = cluster_offsets_[cluster];
+  std::uint32_t end = cluster_offsets_[cluster + 1];
+  int neighbors[4];
+  for (std::uint32_t u = begin; u < end; u++) {
+    std::size_t before = edges->size();
+    LocalBfs(right, bottom, bounds, nodes_[u], dist);
+    for (std::uint32_t v = begin; v < end; v++) {
+      int cell = nodes_[v];
+      int d = (*dist)[(cell / cols_ - bounds.row) * bounds.cols +
+                      cell % cols_ - bounds.col];
+      if (v != u && d > 0) edges->push_back({static_cast<std::int32_t>(v), d});
+    }
+    for (int k = 0, n = Neighbors(right, bottom, nodes_[u], neighbors); k < n;
+         k++) {
+      if (ClusterOf(neighbors[k]) != cluster) {
+        edges->push_back({FindNode(neighbors[k]), 1});
+      }
+    }
+    //  степени пишутся со сдвигом на одну позицию для префиксных сумм
+    (*degrees)[u + 1] = edges->size() - before;
+  }
+}
+
+void PathIndex::LocalBfs(const WallMatrix& right, const WallMatrix& bottom,
+                         const Bounds& bounds, int source,
+                         std::vector<int>* dist) const {
+  auto local = [this, &bounds](int cell) {
+    return (cell / cols_ - bounds.row) * bounds.cols + cell % cols_ -
+           bounds.col;
+  };
+  auto inside = [this, &bounds](int cell) {
+    int row = cell / cols_ - bounds.row, col = cell % cols_ - bounds.col;
+    return row >= 0 && col >= 0 && row < bounds.rows && col < bounds.cols;
+  };
+  dist->assign(bounds.rows * bounds.cols, -1);
+  std::vector<int> queue;
+  queue.reserve(dist->size());
+  queue.push_back(source);
+  (*dist)[local(source)] = 0;
+  int neighbors[4];
+  for (std::size_t head = 0; head < queue.size(); head++) {
+    int cell = queue[head];
+    for (int k = 0, n = Neighbors(right, bottom, cell, neighbors); k < n; k++) {
+      if (inside(neighbors[k]) && (*dist)[local(neighbors[k])] < 0) {
+        (*dist)[local(neighbors[k])] = (*dist)[local(cell)] + 1;
+        queue.push_back(neighbors[k]);
+      }
+    }
+  }
+}
+
+void PathIndex::AppendSegment(const WallMatrix& right, const WallMatrix& bottom,
+                              int from, int to,
+                              std::vector<Point>* path) const {
+  if (from == to) return;
+  if (ClusterOf(from) != ClusterOf(to)) {
+    path->push_back({to / cols_, to % cols_});
+    return;
+  }
+  Bounds bounds = GetBounds(ClusterOf(from));
+  std::vector<int> dist;
+  LocalBfs(right, bottom, bounds, to, &dist);
+  auto local = [this, &bounds](int cell) {
+    return (cell / cols_ - bounds.row) * bounds.cols + cell % cols_ -
+           bounds.col;
+  };
+  int neighbors[4];
+  for (int cell = from; cell != to;) {
+    int current = dist[local(cell)];
+    for (int k = 0, n = Neighbors(right, bottom, cell, neighbors); k < n; k++) {
+      if (ClusterOf(neighbors[k]) == ClusterOf(from) &&
+          dist[local(neighbors[k])] == current - 1) {
+        cell = neighbors[k];
+        break;
+      }
+    }
+    path->push_back({cell / cols_, cell % cols_});
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,188 @@
+#ifndef SRC_MODEL_S21_PATH_INDEX_H_
+#define SRC_MODEL_S21_PATH_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "s21_memory.h"
+#include "s21_point.h"
+
+namespace s21 {
+
+/**
+ * Иерархический индекс для поиска путей в больших лабиринтах, в том числе
+ * с циклами. Лабиринт делится на квадратные кластеры, вершинами
+ * абстрактного графа служат клетки с проходом через границу кластера.
+ * Расстояния между вершинами одного кластера считаются заранее, поэтому
+ * запрос проходит по абстрактному графу и уточняется только внутри
+ * кластеров, через которые идет найденный путь
+ */
+class PathIndex {
+ public:
+  /**
+   * Размер кластера по умолчанию
+   */
+  static constexpr int kDefaultCluster = 16;
+
+  /**
+   * Ребро абстрактного графа
+   */
+  struct Edge {
+    /**
+     * Номер вершины, в которую ведет ребро
+     */
+    std::int32_t to;
+    /**
+     * Длина ребра в ходах
+     */
+    std::int32_t cost;
+  };
+
+  /**
+   * Метод построения индекса, кластеры обрабатываются параллельно
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param cluster - сторона кластера в клетках, не меньше 2; сторона
+   * больше лабиринта уменьшается до его размера
+   * @param threads - число потоков, 0 - по числу ядер
+   */
+  void Build(const WallMatrix& right, const WallMatrix& bottom,
+             int cluster = kDefaultCluster, int threads = 0);
+  /**
+   * Метод сброса индекса
+   */
+  void Clear();
+  /**
+   * Метод проверки, построен ли индекс
+   */
+  bool IsValid() const { return cluster_ > 0; }
+  /**
+   * Метод получения стороны кластера
+   */
+  int GetClusterSize() const { return cluster_; }
+  /**
+   * Метод получения числа вершин абстрактного графа
+   */
+  std::size_t GetNodeCount() const { return nodes_.size(); }
+  /**
+   * Метод получения числа ребер абстрактного графа
+   */
+  std::size_t GetEdgeCount() const { return edges_.size(); }
+  /**
+   * Метод сохранения индекса в файл
+   * @param filename - имя файла
+   * @return - успешно ли сохранение
+   */
+  bool Save(const std::string& filename) const;
+  /**
+   * Метод чтения индекса из файла. Индекс принимается, только если он
+   * построен для этого же лабиринта
+   * @param filename - имя файла
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @return - удалось ли прочитать индекс
+   */
+  bool Load(const std::string& filename, const WallMatrix& right,
+            const WallMatrix& bottom);
+  /**
+   * Метод получения имени файла индекса рядом с файлом лабиринта
+   * @param maze_filename - имя файла лабиринта
+   */
+  static std::string FileFor(const std::string& maze_filename);
+  /**
+   * Метод подсчета отпечатка стен лабиринта
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   */
+  static std::uint64_t Fingerprint(const WallMatrix& right,
+                                   const WallMatrix& bottom);
+  /**
+   * Метод поиска кратчайшего пути
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь в формате Model::GetPath, пустой если пути нет
+   */
+  std::vector<Point> GetPath(const WallMatrix& right, const WallMatrix& bottom,
+                             const Point& start, const Point& end) const;
+
+ protected:
+  /**
+   * Границы кластера
+   */
+  struct Bounds {
+    int row;
+    int col;
+    int rows;
+    int cols;
+  };
+
+  /**
+   * Метод получения границ кластера
+   */
+  Bounds GetBounds(int cluster) const;
+  /**
+   * Метод получения номера кластера клетки
+   */
+  int ClusterOf(int cell) const;
+  /**
+   * Метод поиска вершины графа по номеру клетки
+   * @return - номер вершины или -1
+   */
+  int FindNode(int cell) const;
+  /**
+   * Метод получения соседей клетки без стены между ними
+   */
+  int Neighbors(const WallMatrix& right,
+                const WallMatrix& bottom, int cell,
+                int (&neighbors)[4]) const;
+  /**
+   * Метод поиска клеток кластера с проходом через его границу
+   */
+  void FindEntrances(const WallMatrix& right, const WallMatrix& bottom,
+                     int cluster, std::vector<std::int32_t>* cells) const;
+  /**
+   * Метод построения ребер вершин кластера
+   */
+  void ConnectCluster(const WallMatrix& right, const WallMatrix& bottom,
+                      int cluster, std::vector<int>* dist,
+                      std::vector<Edge>* edges,
+                      std::vector<std::uint64_t>* degrees) const;
+  /**
+   * Метод обхода в ширину внутри кластера
+   * @param bounds - границы кластера
+   * @param source - исходная клетка
+   * @param dist - расстояния по локальным номерам клеток кластера
+   */
+  void LocalBfs(const WallMatrix& right, const WallMatrix& bottom,
+                const Bounds& bounds, int source, std::vector<int>* dist) const;
+  /**
+   * Метод проверки прочитанных из файла массивов: смещения не убывают и
+   * сходятся с размерами массивов, вершины кластера лежат в нем по
+   * возрастанию, ребра ведут в существующие вершины
+   */
+  bool IsConsistent() const;
+  /**
+   * Метод дописывания к пути отрезка от клетки from до клетки to без
+   * самой клетки from
+   */
+  void AppendSegment(const WallMatrix& right, const WallMatrix& bottom,
+                     int from, int to, std::vector<Point>* path) const;
+
+ private:
+  int rows_ = 0;
+  int cols_ = 0;
+  int cluster_ = 0;
+  int cluster_cols_ = 0;
+  std::uint64_t fingerprint_ = 0;
+  std::vector<std::uint32_t> cluster_offsets_;
+  std::vector<std::int32_t> nodes_;
+  std::vector<std::uint64_t> edge_offsets_;
+  std::vector<Edge> edges_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_PATH_INDEX_H_
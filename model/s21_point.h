@@ -0,0 +1,31 @@
+#ifndef SRC_MODEL_S21_POINT_H_
+#define SRC_MODEL_S21_POINT_H_
+
+namespace s21 {
+
+/**
+ * Структура для хранения координат
+ */
+struct Point {
+  /**
+   * Координата по оси Х
+   */
+  int row;
+  /**
+   * Координата по оси Y
+   */
+  int col;
+  /**
+   * Конструктор
+   */
+  Point() : row(0), col(0) {}
+  /**
+   * Конструктор
+   * @param row - координата по оси Х
+   * @param col - координата по оси Y
+   */
+  Point(int row, int col) : row(row), col(col) {}
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_POINT_H_
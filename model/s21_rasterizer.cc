@@ -0,0 +1,268 @@
+#include "s21_rasterizer.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <tuple>
+
+namespace s21 {
+
+namespace {
+
+//  номера цветов палитры
+enum Color : std::uint8_t { kWhite, kBlack, kGreen, kBlue, kRed };
+
+constexpr unsigned char kPalette[] = {255, 255, 255, 0,   0, 0, 0, 255,
+                                      0,   0,   0,   255, 255, 0, 0};
+constexpr unsigned char kSignature[] = {0x89, 'P',  'N',  'G',
+                                        '\r', '\n', 0x1A, '\n'};
+
+//  закодированная полоса изображения
+struct Band {
+  std::vector<std::uint8_t> pixels;
+  std::vector<unsigned char> raw;
+  std::vector<unsigned char> data;
+  uLong adler = 0;
+  bool ok = true;
+};
+
+void PutU32(unsigned char* out, std::uint32_t value) {
+  out[0] = value >> 24;
+  out[1] = value >> 16;
+  out[2] = value >> 8;
+  out[3] = value;
+}
+
+bool WriteChunk(std::FILE* file, const char* type, const unsigned char* data,
+                std::size_t size) {
+  unsigned char head[8], tail[4];
+  PutU32(head, size);
+  std::copy(type, type + 4, head + 4);
+  uLong crc = crc32(0, head + 4, 4);
+  if (size) crc = crc32(crc, data, size);
+  PutU32(tail, crc);
+  return std::fwrite(head, 1, 8, file) == 8 &&
+         (!size || std::fwrite(data, 1, size, file) == size) &&
+         std::fwrite(tail, 1, 4, file) == 4;
+}
+
+//  полоса сжимается отдельным куском deflate, куски выравниваются по
+//  байту сбросом Z_SYNC_FLUSH и склеиваются в один поток zlib
+bool Deflate(const std::vector<unsigned char>& raw, bool last,
+             std::vector<unsigned char>* data) {
+  z_stream stream{};
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    return false;
+  }
+  data->resize(deflateBound(&stream, raw.size()) + 16);
+  stream.next_in = const_cast<unsigned char*>(raw.data());
+  stream.avail_in = raw.size();
+  stream.next_out = data->data();
+  stream.avail_out = data->size();
+  int status = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+  bool ok = last ? status == Z_STREAM_END
+                 : status == Z_OK && stream.avail_in == 0 &&
+                       stream.avail_out > 0;
+  data->resize(stream.total_out);
+  deflateEnd(&stream);
+  return ok;
+}
+
+}  // namespace
+
+MazeRasterizer::MazeRasterizer(int threads) : threads_(threads) {}
+
+RasterFormat MazeRasterizer::FormatFromName(const std::string& filename) {
+  const std::string suffix = ".pbm";
+  bool pbm = filename.size() >= suffix.size() &&
+             filename.compare(filename.size() - suffix.size(), suffix.size(),
+                              suffix) == 0;
+  return pbm ? RasterFormat::kPbm : RasterFormat::kPng;
+}
+
+void MazeRasterizer::SetCellSize(int pixels) {
+  if (pixels < 2) {
+    throw std::invalid_argument("Сторона клетки должна быть не меньше 2.");
+  }
+  cell_ = pixels;
+}
+
+void MazeRasterizer::SetPath(const CompactPath& path) {
+  runs_.clear();
+  if (path.Empty()) return;
+  for (const auto& run : path.GetRuns()) runs_.push_back(run);
+  SetEnd(path.Front());
+  SetStart(runs_.empty() ? path.Front() : runs_.back().to);
+}
+
+void MazeRasterizer::SetStart(const Point& start) {
+  start_ = start;
+  has_start_ = true;
+}
+
+void MazeRasterizer::SetEnd(const Point& end) {
+  end_ = end;
+  has_end_ = true;
+}
+
+void MazeRasterizer::ClearOverlay() {
+  runs_.clear();
+  has_start_ = false;
+  has_end_ = false;
+}
+
+bool MazeRasterizer::Write(const std::string& filename, const WallMatrix& right,
+                           const WallMatrix& bottom, RasterFormat format) {
+  int rows = right.size();
+  int cols = rows ? right[0].size() : 0;
+  if (!rows || !cols) return false;
+  width_ = cols * cell_ + 1;
+  int height = rows * cell_ + 1;
+  bool png = format == RasterFormat::kPng;
+  std::size_t row_bytes = png ? width_ + 1 : (width_ + 7) / 8;
+  int band_rows = std::max<std::size_t>(1, kBandBytes / (row_bytes * cell_));
+  int bands = (rows + band_rows - 1) / band_rows;
+
+  //  участки пути по полосам, которые они задевают
+  std::vector<std::vector<int>> band_runs(bands);
+  for (std::size_t k = 0; k < runs_.size(); k++) {
+    int first = std::min(runs_[k].from.row, runs_[k].to.row) / band_rows;
+    int last = std::max(runs_[k].from.row, runs_[k].to.row) / band_rows;
+    for (int b = std::max(first, 0); b <= std::min(last, bands - 1); b++) {
+      band_runs[b].push_back(k);
+    }
+  }
+
+  std::FILE* file = std::fopen(filename.c_str(), "wb");
+  if (!file) return false;
+  bool ok = true;
+  if (png) {
+    unsigned char header[13] = {};
+    PutU32(header, width_);
+    PutU32(header + 4, height);
+    header[8] = 8;  //  бит на пиксель
+    header[9] = 3;  //  цвета из палитры
+    const unsigned char zlib_header[] = {0x78, 0x01};
+    ok = std::fwrite(kSignature, 1, sizeof(kSignature), file) ==
+             sizeof(kSignature) &&
+         WriteChunk(file, "IHDR", header, sizeof(header)) &&
+         WriteChunk(file, "PLTE", kPalette, sizeof(kPalette)) &&
+         WriteChunk(file, "IDAT", zlib_header, sizeof(zlib_header));
+  } else {
+    ok = std::fprintf(file, "P4\n%d %d\n", width_, height) > 0;
+  }
+
+  if (!pool_) pool_ = std::make_unique<ThreadPool>(threads_);
+  std::vector<Band> window(pool_->Size());
+  uLong adler = adler32(0, nullptr, 0);
+  for (int begin = 0; begin < bands && ok; begin += window.size()) {
+    int count = std::min<int>(window.size(), bands - begin);
+    pool_->ParallelFor(count, [&](std::size_t slot, int) {
+      Band& band = window[slot];
+      int b = begin + slot;
+      int y_begin = b == 0 ? 0 : b * band_rows * cell_ + 1;
+      int y_end = std::min(rows, (b + 1) * band_rows) * cell_ + 1;
+      band.pixels.resize(width_);
+      band.raw.clear();
+      band.raw.reserve((y_end - y_begin) * row_bytes);
+      for (int y = y_begin; y < y_end; y++) {
+        RenderRow(y, right, bottom, band_runs[b], band.pixels.data());
+        if (png) {
+          band.raw.push_back(0);  //  строка без фильтра
+          band.raw.insert(band.raw.end(), band.pixels.begin(),
+                          band.pixels.end());
+          continue;
+        }
+        std::size_t base = band.raw.size();
+        band.raw.resize(base + row_bytes, 0);
+        for (int x = 0; x < width_; x++) {
+          if (band.pixels[x] != kWhite) {
+            band.raw[base + x / 8] |= 0x80 >> x % 8;
+          }
+        }
+      }
+      if (png) {
+        band.adler = adler32(0, nullptr, 0);
+        band.adler = adler32(band.adler, band.raw.data(), band.raw.size());
+        band.ok = Deflate(band.raw, b == bands - 1, &band.data);
+      }
+    });
+    for (int slot = 0; slot < count && ok; slot++) {
+      Band& band = window[slot];
+      if (png) {
+        adler = adler32_combine(adler, band.adler, band.raw.size());
+        ok = band.ok &&
+             WriteChunk(file, "IDAT", band.data.data(), band.data.size());
+      } else {
+        ok = std::fwrite(band.raw.data(), 1, band.raw.size(), file) ==
+             band.raw.size();
+      }
+    }
+  }
+  if (png && ok) {
+    unsigned char trailer[4];
+    PutU32(trailer, adler);
+    ok = WriteChunk(file, "IDAT", trailer, sizeof(trailer)) &&
+         WriteChunk(file, "IEND", nullptr, 0);
+  }
+  ok = std::fclose(file) == 0 && ok;
+  return ok;
+}
+
+void MazeRasterizer::RenderRow(int y, const WallMatrix& right,
+                               const WallMatrix& bottom,
+                               const std::vector<int>& runs,
+                               std::uint8_t* pixels) const {
+  //  внешняя стена сверху
+  if (y == 0) {
+    std::fill(pixels, pixels + width_, kBlack);
+    return;
+  }
+  std::fill(pixels, pixels + width_, kWhite);
+  int rows = right.size(), cols = right[0].size();
+  int row = (y - 1) / cell_;
+  bool line = y == (row + 1) * cell_;
+  pixels[0] = kBlack;
+  for (int col = 0; col < cols; col++) {
+    int x = (col + 1) * cell_;
+    if (line && bottom[row][col]) {
+      std::fill(pixels + x - cell_, pixels + x + 1, kBlack);
+    }
+    //  на линии стен снизу угол закрашивается и для стены строкой ниже
+    if (right[row][col] || (line && row + 1 < rows && right[row + 1][col])) {
+      pixels[x] = kBlack;
+    }
+  }
+
+  auto center = [this](int index) { return index * cell_ + cell_ / 2; };
+  auto fill = [this, pixels](int x_begin, int x_end, std::uint8_t color) {
+    std::fill(pixels + std::max(x_begin, 0), pixels + std::min(x_end, width_),
+              color);
+  };
+  int thickness = std::max(1, cell_ / 4);
+  for (int k : runs) {
+    const CompactPath::Run& run = runs_[k];
+    int y_begin = center(std::min(run.from.row, run.to.row)) - thickness / 2;
+    int y_end = center(std::max(run.from.row, run.to.row)) - thickness / 2 +
+                thickness;
+    if (y < y_begin || y >= y_end) continue;
+    fill(center(std::min(run.from.col, run.to.col)) - thickness / 2,
+         center(std::max(run.from.col, run.to.col)) - thickness / 2 +
+             thickness,
+         kGreen);
+  }
+  int side = std::max(1, cell_ / 2);
+  for (auto [has, point, color] : {std::tuple{has_start_, start_, kBlue},
+                                   std::tuple{has_end_, end_, kRed}}) {
+    int top = center(point.row) - side / 2;
+    if (has && y >= top && y < top + side) {
+      int left = center(point.col) - side / 2;
+      fill(left, left + side, color);
+    }
+  }
+}
+
+}  // namespace s21
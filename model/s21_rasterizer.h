@@ -0,0 +1,105 @@
+#ifndef SRC_MODEL_S21_RASTERIZER_H_
+#define SRC_MODEL_S21_RASTERIZER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "s21_compact_path.h"
+#include "s21_memory.h"
+#include "s21_point.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+/**
+ * Формат изображения лабиринта
+ */
+enum class RasterFormat { kPbm, kPng };
+
+/**
+ * Отрисовка лабиринта, пути и отметок начала и конца в файл изображения
+ * без Qt. Изображение делится на полосы из целых строк лабиринта, полосы
+ * рисуются и сжимаются параллельно и пишутся в файл по порядку, поэтому в
+ * памяти держится только несколько полос. PNG получается с палитрой
+ * цветов View, PBM - черно-белый
+ */
+class MazeRasterizer {
+ public:
+  /**
+   * Сторона клетки в пикселях по умолчанию
+   */
+  static constexpr int kDefaultCell = 8;
+  /**
+   * Примерный размер одной полосы в байтах
+   */
+  static constexpr std::size_t kBandBytes = std::size_t{1} << 22;
+
+  /**
+   * Конструктор
+   * @param threads - число потоков, 0 - по числу ядер
+   */
+  explicit MazeRasterizer(int threads = 0);
+  /**
+   * Метод выбора формата по расширению файла (.pbm, иначе PNG)
+   * @param filename - имя файла
+   */
+  static RasterFormat FormatFromName(const std::string& filename);
+  /**
+   * Метод установки стороны клетки
+   * @param pixels - сторона клетки в пикселях, не меньше 2
+   */
+  void SetCellSize(int pixels);
+  /**
+   * Метод установки пути, начальная и конечная точки пути отмечаются
+   * @param path - путь от конечной точки к начальной
+   */
+  void SetPath(const CompactPath& path);
+  /**
+   * Метод установки отметки начальной точки
+   */
+  void SetStart(const Point& start);
+  /**
+   * Метод установки отметки конечной точки
+   */
+  void SetEnd(const Point& end);
+  /**
+   * Метод удаления пути и отметок
+   */
+  void ClearOverlay();
+  /**
+   * Метод записи изображения лабиринта
+   * @param filename - имя файла
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param format - формат изображения
+   * @return - успешна ли запись
+   */
+  bool Write(const std::string& filename, const WallMatrix& right,
+             const WallMatrix& bottom, RasterFormat format);
+
+ protected:
+  /**
+   * Метод отрисовки строки пикселей номерами цветов палитры
+   * @param y - номер строки пикселей
+   * @param runs - участки пути, задевающие полосу строки
+   * @param pixels - строка пикселей
+   */
+  void RenderRow(int y, const WallMatrix& right, const WallMatrix& bottom,
+                 const std::vector<int>& runs, std::uint8_t* pixels) const;
+
+ private:
+  int threads_;
+  std::unique_ptr<ThreadPool> pool_;
+  int cell_ = kDefaultCell;
+  int width_ = 0;
+  std::vector<CompactPath::Run> runs_;
+  bool has_start_ = false;
+  bool has_end_ = false;
+  Point start_;
+  Point end_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_RASTERIZER_H_
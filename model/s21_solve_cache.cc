@@ -0,0 +1,267 @@
+#include "s21_solve_cache.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace s21 {
+
+namespace {
+
+constexpr char kMagic[8] = {'S', '2', '1', 'S', 'O', 'L', 'V', '\0'};
+constexpr std::uint32_t kVersion = 1;
+//  число записей, просматриваемых от домашней позиции
+constexpr std::uint32_t kProbes = 8;
+
+enum Kind : std::uint32_t { kEmpty, kPath, kStats };
+
+struct Header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t slots;
+  std::uint64_t data_end;
+};
+
+constexpr std::int32_t kNoKey[4] = {0, 0, 0, 0};
+
+std::size_t Align(std::size_t bytes) { return (bytes + 7) & ~std::size_t{7}; }
+
+//  блокировка файла на время жизни объекта: читатели берут общую,
+//  писатели - исключительную
+class FileLock {
+ public:
+  FileLock(int fd, int operation)
+      : fd_(fd), locked_(flock(fd, operation) == 0) {}
+  ~FileLock() {
+    if (locked_) flock(fd_, LOCK_UN);
+  }
+  FileLock(const FileLock&) = delete;
+  FileLock& operator=(const FileLock&) = delete;
+  bool IsLocked() const { return locked_; }
+
+ private:
+  int fd_;
+  bool locked_;
+};
+
+}  // namespace
+
+SolveCache::~SolveCache() { Close(); }
+
+bool SolveCache::Open(const std::string& filename, std::uint32_t slots) {
+  Close();
+  fd_ = open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd_ < 0) return false;
+  //  два процесса не должны одновременно размечать новый файл. Отображение
+  //  держит файл открытым, поэтому блокировка снимается явно
+  if (flock(fd_, LOCK_EX) != 0 || !Attach(slots)) {
+    Close();
+    return false;
+  }
+  flock(fd_, LOCK_UN);
+  return true;
+}
+
+bool SolveCache::Attach(std::uint32_t slots) {
+  struct stat st;
+  if (fstat(fd_, &st) != 0) return false;
+  if (st.st_size == 0) {
+    //  новый файл: нули в таблице означают свободные записи
+    std::size_t size = sizeof(Header) + std::max(slots, 1u) * sizeof(Slot);
+    if (ftruncate(fd_, size) != 0 || !Map(size)) return false;
+    Header* header = reinterpret_cast<Header*>(data_);
+    std::memcpy(header->magic, kMagic, sizeof(kMagic));
+    header->version = kVersion;
+    header->slots = std::max(slots, 1u);
+    header->data_end = size;
+    return true;
+  }
+  if (st.st_size < static_cast<off_t>(sizeof(Header)) || !Map(st.st_size)) {
+    return false;
+  }
+  const Header* header = reinterpret_cast<const Header*>(data_);
+  return std::memcmp(header->magic, kMagic, sizeof(kMagic)) == 0 &&
+         header->version == kVersion && header->slots != 0 &&
+         sizeof(Header) + header->slots * sizeof(Slot) <= header->data_end &&
+         header->data_end <= size_;
+}
+
+void SolveCache::Close() {
+  if (data_) munmap(data_, size_);
+  if (fd_ >= 0) close(fd_);
+  data_ = nullptr;
+  size_ = 0;
+  fd_ = -1;
+}
+
+bool SolveCache::FindPath(std::uint64_t maze, const Point& start,
+                          const Point& end, std::vector<Point>* path) {
+  const std::int32_t key[4] = {start.row, start.col, end.row, end.col};
+  const void* data;
+  std::uint32_t size;
+  if (!Find(maze, kPath, key, &data, &size)) return false;
+  const std::int32_t* values = static_cast<const std::int32_t*>(data);
+  path->clear();
+  path->reserve(size / sizeof(std::int32_t) / 2);
+  for (std::size_t i = 0; i + 1 < size / sizeof(std::int32_t); i += 2) {
+    path->push_back({values[i], values[i + 1]});
+  }
+  return true;
+}
+
+void SolveCache::StorePath(std::uint64_t maze, const Point& start,
+                           const Point& end, const std::vector<Point>& path) {
+  const std::int32_t key[4] = {start.row, start.col, end.row, end.col};
+  std::vector<std::int32_t> values;
+  values.reserve(path.size() * 2);
+  for (const Point& point : path) {
+    values.push_back(point.row);
+    values.push_back(point.col);
+  }
+  Store(maze, kPath, key, values.data(), values.size() * sizeof(values[0]));
+}
+
+bool SolveCache::FindStats(std::uint64_t maze, MazeStats* stats) {
+  const void* data;
+  std::uint32_t size;
+  if (!Find(maze, kStats, kNoKey, &data, &size) ||
+      size != 9 * sizeof(std::int32_t)) {
+    return false;
+  }
+  const std::int32_t* values = static_cast<const std::int32_t*>(data);
+  stats->diameter = values[0];
+  stats->diameter_start = Point(values[1], values[2]);
+  stats->diameter_end = Point(values[3], values[4]);
+  stats->dead_ends = values[5];
+  stats->corridors = values[6];
+  stats->junctions = values[7];
+  stats->isolated = values[8];
+  return true;
+}
+
+void SolveCache::StoreStats(std::uint64_t maze, const MazeStats& stats) {
+  const std::int32_t values[9] = {stats.diameter,
+                                  stats.diameter_start.row,
+                                  stats.diameter_start.col,
+                                  stats.diameter_end.row,
+                                  stats.diameter_end.col,
+                                  stats.dead_ends,
+                                  stats.corridors,
+                                  stats.junctions,
+                                  stats.isolated};
+  Store(maze, kStats, kNoKey, values, sizeof(values));
+}
+
+SolveCache::Slot* SolveCache::Probe(std::uint64_t maze, std::uint32_t kind,
+                                    const std::int32_t (&key)[4]) {
+  const Header* header = reinterpret_cast<const Header*>(data_);
+  Slot* slots = reinterpret_cast<Slot*>(data_ + sizeof(Header));
+  std::uint64_t hash = maze ^ kind * 0x9E3779B97F4A7C15ULL;
+  for (std::int32_t value : key) {
+    hash = (hash ^ static_cast<std::uint32_t>(value)) * 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 31;
+  }
+  std::uint32_t home = hash % header->slots;
+  for (std::uint32_t i = 0; i < kProbes && i < header->slots; i++) {
+    Slot* slot = &slots[(home + i) % header->slots];
+    if (slot->kind == kEmpty) return slot;
+    if (slot->kind == kind && slot->maze == maze &&
+        std::equal(key, key + 4, slot->key)) {
+      return slot;
+    }
+  }
+  return &slots[home];
+}
+
+std::uint64_t SolveCache::Allocate(std::size_t bytes) {
+  Header* header = reinterpret_cast<Header*>(data_);
+  std::uint64_t offset = header->data_end;
+  std::size_t end = offset + Align(bytes);
+  if (end > size_) {
+    //  файл мог вырасти в другом процессе, и уменьшать его под чужим
+    //  отображением нельзя
+    struct stat st;
+    if (fstat(fd_, &st) != 0) return 0;
+    std::size_t size = st.st_size;
+    if (end > size) {
+      size = std::max(end, size * 2);
+      if (ftruncate(fd_, size) != 0) return 0;
+    }
+    if (!Map(size)) return 0;
+    header = reinterpret_cast<Header*>(data_);
+  }
+  header->data_end = end;
+  return offset;
+}
+
+bool SolveCache::Find(std::uint64_t maze, std::uint32_t kind,
+                      const std::int32_t (&key)[4], const void** data,
+                      std::uint32_t* size) {
+  if (!data_) return false;
+  //  запись читается под общей блокировкой, чтобы не увидеть ее
+  //  наполовину записанной. Данные записей не меняются после публикации,
+  //  поэтому их можно читать после снятия блокировки
+  FileLock lock(fd_, LOCK_SH);
+  const Slot* slot = Probe(maze, kind, key);
+  bool found = lock.IsLocked() && slot->kind == kind && slot->maze == maze &&
+               std::equal(key, key + 4, slot->key);
+  std::uint64_t offset = found ? slot->offset : 0;
+  std::uint64_t end = offset + (found ? slot->size : 0);
+  //  данные за концом отображения дописал другой процесс
+  if (found && end > size_) found = Remap();
+  if (!found || end < offset || end > size_ ||
+      end > reinterpret_cast<const Header*>(data_)->data_end) {
+    misses_++;
+    return false;
+  }
+  *data = data_ + offset;
+  *size = end - offset;
+  hits_++;
+  return true;
+}
+
+void SolveCache::Store(std::uint64_t maze, std::uint32_t kind,
+                       const std::int32_t (&key)[4], const void* data,
+                       std::uint32_t size) {
+  if (!data_) return;
+  //  писатели из разных процессов выделяют место и заполняют таблицу по
+  //  очереди
+  FileLock lock(fd_, LOCK_EX);
+  if (!lock.IsLocked()) return;
+  //  место выделяется до поиска записи: при росте файла отображение
+  //  меняется, и указатель на запись стал бы недействительным
+  std::uint64_t offset = Allocate(size);
+  if (!offset) return;
+  if (size) std::memcpy(data_ + offset, data, size);
+  Slot* slot = Probe(maze, kind, key);
+  slot->maze = maze;
+  std::copy(key, key + 4, slot->key);
+  slot->size = size;
+  slot->offset = offset;
+  slot->kind = kind;
+}
+
+bool SolveCache::Remap() {
+  struct stat st;
+  if (fstat(fd_, &st) != 0) return false;
+  std::size_t size = st.st_size;
+  return size <= size_ || Map(size);
+}
+
+bool SolveCache::Map(std::size_t size) {
+  if (data_) munmap(data_, size_);
+  data_ = nullptr;
+  size_ = 0;
+  void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (map == MAP_FAILED) return false;
+  data_ = static_cast<unsigned char*>(map);
+  size_ = size;
+  return true;
+}
+
+}  // namespace s21
@@ -0,0 +1,147 @@
+#ifndef SRC_MODEL_S21_SOLVE_CACHE_H_
+#define SRC_MODEL_S21_SOLVE_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "s21_maze_stats.h"
+#include "s21_point.h"
+
+namespace s21 {
+
+/**
+ * Кэш найденных путей и статистики лабиринтов в файле, отображенном в
+ * память. Записи ищутся по хэшу содержимого лабиринта MazeHash, поэтому
+ * кэш переживает перезапуск программы и переименование файлов. Файл
+ * состоит из заголовка, таблицы записей с открытой адресацией и области
+ * данных, которая растет в конец. При заполнении таблицы новая запись
+ * вытесняет старую, данные вытесненных записей не освобождаются до
+ * удаления файла. Файл можно делить между процессами: запись идет под
+ * исключительной блокировкой flock, чтение записи таблицы - под общей, а
+ * отображение расширяется, когда данные дописал другой процесс
+ */
+class SolveCache {
+ public:
+  /**
+   * Число записей таблицы по умолчанию
+   */
+  static constexpr std::uint32_t kDefaultSlots = 1 << 16;
+
+  /**
+   * Конструктор
+   */
+  SolveCache() = default;
+  /**
+   * Деструктор, снимает отображение файла
+   */
+  ~SolveCache();
+  SolveCache(const SolveCache&) = delete;
+  SolveCache& operator=(const SolveCache&) = delete;
+
+  /**
+   * Метод открытия кэша, файл создается при отсутствии
+   * @param filename - имя файла
+   * @param slots - число записей таблицы нового файла
+   * @return - удалось ли открыть кэш
+   */
+  bool Open(const std::string& filename, std::uint32_t slots = kDefaultSlots);
+  /**
+   * Метод закрытия кэша
+   */
+  void Close();
+  /**
+   * Метод проверки, открыт ли кэш
+   */
+  bool IsOpen() const { return data_ != nullptr; }
+  /**
+   * Метод поиска пути в кэше
+   * @param maze - хэш лабиринта
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @param path - путь в формате Model::GetPath, пустой путь тоже
+   * сохраняется
+   * @return - найден ли путь в кэше
+   */
+  bool FindPath(std::uint64_t maze, const Point& start, const Point& end,
+                std::vector<Point>* path);
+  /**
+   * Метод сохранения пути
+   * @param maze - хэш лабиринта
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @param path - путь в формате Model::GetPath
+   */
+  void StorePath(std::uint64_t maze, const Point& start, const Point& end,
+                 const std::vector<Point>& path);
+  /**
+   * Метод поиска статистики лабиринта в кэше
+   * @param maze - хэш лабиринта
+   * @param stats - статистика
+   * @return - найдена ли статистика в кэше
+   */
+  bool FindStats(std::uint64_t maze, MazeStats* stats);
+  /**
+   * Метод сохранения статистики лабиринта
+   * @param maze - хэш лабиринта
+   * @param stats - статистика
+   */
+  void StoreStats(std::uint64_t maze, const MazeStats& stats);
+  /**
+   * Метод получения числа найденных в кэше записей
+   */
+  std::uint64_t GetHits() const { return hits_; }
+  /**
+   * Метод получения числа ненайденных записей
+   */
+  std::uint64_t GetMisses() const { return misses_; }
+
+ protected:
+  /**
+   * Запись таблицы
+   */
+  struct Slot {
+    std::uint64_t maze;
+    std::uint32_t kind;
+    std::int32_t key[4];
+    std::uint32_t size;
+    std::uint64_t offset;
+  };
+
+  /**
+   * Метод поиска записи
+   * @return - запись с ключом, свободная или вытесняемая запись
+   */
+  Slot* Probe(std::uint64_t maze, std::uint32_t kind,
+              const std::int32_t (&key)[4]);
+  /**
+   * Метод выделения места в области данных, файл при нехватке растет.
+   * Вызывается под исключительной блокировкой файла
+   * @param bytes - размер данных
+   * @return - смещение данных или 0, если файл не удалось увеличить
+   */
+  std::uint64_t Allocate(std::size_t bytes);
+
+ private:
+  bool Find(std::uint64_t maze, std::uint32_t kind,
+            const std::int32_t (&key)[4], const void** data,
+            std::uint32_t* size);
+  void Store(std::uint64_t maze, std::uint32_t kind,
+             const std::int32_t (&key)[4], const void* data,
+             std::uint32_t size);
+  //  размечает новый файл или проверяет заголовок существующего
+  bool Attach(std::uint32_t slots);
+  bool Map(std::size_t size);
+  //  отображает файл целиком, если другой процесс его увеличил
+  bool Remap();
+
+  int fd_ = -1;
+  unsigned char* data_ = nullptr;
+  std::size_t size_ = 0;
+  std::uint64_t hits_ = 0;
+  std::uint64_t misses_ = 0;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_SOLVE_CACHE_H_
@@ -0,0 +1,115 @@
+#include "s21_step_solver.h"
+
+#include <stdexcept>
+
+namespace s21 {
+
+void StepSolver::Start(const WallMatrix& right, const WallMatrix& bottom,
+                       const Point& start, const Point& end) {
+  rows_ = right.size();
+  cols_ = rows_ ? right[0].size() : 0;
+  auto inside = [this](const Point& p) {
+    return p.row >= 0 && p.col >= 0 && p.row < rows_ && p.col < cols_;
+  };
+  if (!inside(start) || !inside(end)) {
+    throw std::invalid_argument("Неверные координаты точек.");
+  }
+  right_ = &right;
+  bottom_ = &bottom;
+  end_ = end;
+  dist_.assign(rows_ * cols_, -1);
+  //  каждая клетка попадает в очередь один раз, поэтому память выделяется
+  //  сразу и указатели GetVisited и GetFrontier не меняются
+  queue_.clear();
+  queue_.reserve(rows_ * cols_);
+  queue_.push_back(start);
+  dist_[start.row * cols_ + start.col] = 0;
+  head_ = 0;
+  done_ = false;
+  found_ = false;
+}
+
+bool StepSolver::Step(std::size_t budget) {
+  if (done_) return true;
+  const WallMatrix& right = *right_;
+  const WallMatrix& bottom = *bottom_;
+  auto visit = [this](int row, int col, int dist) {
+    int& seen = dist_[row * cols_ + col];
+    if (seen >= 0) return;
+    seen = dist;
+    queue_.push_back({row, col});
+  };
+  for (; budget; budget--) {
+    if (head_ == queue_.size()) {
+      done_ = true;
+      break;
+    }
+    Point p = queue_[head_++];
+    if (p.row == end_.row && p.col == end_.col) {
+      done_ = found_ = true;
+      break;
+    }
+    int next = dist_[p.row * cols_ + p.col] + 1;
+    if (p.col < cols_ - 1 && !right[p.row][p.col]) {
+      visit(p.row, p.col + 1, next);
+    }
+    if (p.col > 0 && !right[p.row][p.col - 1]) {
+      visit(p.row, p.col - 1, next);
+    }
+    if (p.row > 0 && !bottom[p.row - 1][p.col]) {
+      visit(p.row - 1, p.col, next);
+    }
+    if (p.row < rows_ - 1 && !bottom[p.row][p.col]) {
+      visit(p.row + 1, p.col, next);
+    }
+  }
+  return done_;
+}
+
+bool StepSolver::StepFor(std::chrono::microseconds time,
+                         std::size_t granularity) {
+  auto deadline = std::chrono::steady_clock::now() + time;
+  while (!Step(granularity ? granularity : 1) &&
+         std::chrono::steady_clock::now() < deadline) {
+  }
+  return done_;
+}
+
+void StepSolver::Reset() {
+  right_ = nullptr;
+  bottom_ = nullptr;
+  queue_.clear();
+  head_ = 0;
+  done_ = true;
+  found_ = false;
+}
+
+std::vector<Point> StepSolver::GetPath() const {
+  std::vector<Point> path;
+  if (!found_) return path;
+  const WallMatrix& right = *right_;
+  const WallMatrix& bottom = *bottom_;
+  Point pos = end_;
+  path.reserve(GetDistance(end_) + 1);
+  path.push_back(pos);
+  //  тот же порядок соседей, что и в Model::FindPath
+  for (int count = GetDistance(end_); count > 0; count--) {
+    int prev = count - 1;
+    if (pos.col < cols_ - 1 && GetDistance({pos.row, pos.col + 1}) == prev &&
+        !right[pos.row][pos.col]) {
+      ++pos.col;
+    } else if (pos.col > 0 && GetDistance({pos.row, pos.col - 1}) == prev &&
+               !right[pos.row][pos.col - 1]) {
+      --pos.col;
+    } else if (pos.row > 0 && GetDistance({pos.row - 1, pos.col}) == prev &&
+               !bottom[pos.row - 1][pos.col]) {
+      --pos.row;
+    } else {
+      ++pos.row;
+    }
+    path.push_back(pos);
+  }
+  return path;
+}
+
+}  // namespace s21
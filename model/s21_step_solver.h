@@ -0,0 +1,112 @@
+#ifndef SRC_MODEL_S21_STEP_SOLVER_H_
+#define SRC_MODEL_S21_STEP_SOLVER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "s21_memory.h"
+#include "s21_point.h"
+
+namespace s21 {
+
+/**
+ * Непрерывный участок точек без копирования
+ */
+class PointRange {
+ public:
+  PointRange(const Point* begin, const Point* end) : begin_(begin), end_(end) {}
+  const Point* begin() const { return begin_; }
+  const Point* end() const { return end_; }
+  std::size_t size() const { return end_ - begin_; }
+  bool empty() const { return begin_ == end_; }
+
+ private:
+  const Point* begin_;
+  const Point* end_;
+};
+
+/**
+ * Поиск пути в ширину, который выполняется частями. Очередь обхода
+ * хранится одним массивом: до головы лежат просмотренные клетки, после
+ * головы - фронт волны, поэтому оба множества отдаются без копирования.
+ * Путь совпадает с путем Model::GetPath
+ */
+class StepSolver {
+ public:
+  /**
+   * Метод начала поиска. Матрицы стен не копируются и не должны
+   * меняться до конца поиска
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   */
+  void Start(const WallMatrix& right, const WallMatrix& bottom,
+             const Point& start, const Point& end);
+  /**
+   * Метод продолжения поиска
+   * @param budget - наибольшее число клеток, просматриваемых за вызов
+   * @return - завершен ли поиск
+   */
+  bool Step(std::size_t budget);
+  /**
+   * Метод продолжения поиска, пока не истечет время
+   * @param time - время на вызов
+   * @param granularity - число клеток между проверками времени
+   * @return - завершен ли поиск
+   */
+  bool StepFor(std::chrono::microseconds time, std::size_t granularity = 256);
+  /**
+   * Метод остановки поиска, например при изменении лабиринта
+   */
+  void Reset();
+  /**
+   * Метод проверки, завершен ли поиск
+   */
+  bool Done() const { return done_; }
+  /**
+   * Метод проверки, найдена ли конечная точка
+   */
+  bool Found() const { return found_; }
+  /**
+   * Метод получения просмотренных клеток в порядке просмотра
+   */
+  PointRange GetVisited() const {
+    return {queue_.data(), queue_.data() + head_};
+  }
+  /**
+   * Метод получения фронта волны: клеток, до которых дошел поиск, но
+   * которые еще не просмотрены
+   */
+  PointRange GetFrontier() const {
+    return {queue_.data() + head_, queue_.data() + queue_.size()};
+  }
+  /**
+   * Метод получения расстояния от начальной точки до клетки
+   * @return - расстояние или -1, если поиск до клетки не дошел
+   */
+  int GetDistance(const Point& point) const {
+    return dist_[point.row * cols_ + point.col];
+  }
+  /**
+   * Метод получения пути после завершения поиска
+   * @return - путь от конечной точки к начальной или пустой путь
+   */
+  std::vector<Point> GetPath() const;
+
+ private:
+  const WallMatrix* right_ = nullptr;
+  const WallMatrix* bottom_ = nullptr;
+  int rows_ = 0;
+  int cols_ = 0;
+  Point end_;
+  std::vector<int> dist_;
+  std::vector<Point> queue_;
+  std::size_t head_ = 0;
+  bool done_ = true;
+  bool found_ = false;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_STEP_SOLVER_H_
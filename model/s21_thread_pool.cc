@@ -0,0 +1,75 @@
+#include "s21_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace s21 {
+
+ThreadPool::ThreadPool(int threads) {
+  if (threads <= 0) threads = std::thread::hardware_concurrency();
+  if (threads <= 0) threads = 1;
+  for (int i = 0; i < threads; i++) workers_.emplace_back([this] { Work(); });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  ready_.notify_all();
+  for (auto& worker : workers_) worker.join();
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push(std::move(task));
+  }
+  ready_.notify_one();
+}
+
+void ThreadPool::Wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this] { return tasks_.empty() && active_ == 0; });
+}
+
+void ThreadPool::Work() {
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      ready_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) return;
+      task = std::move(tasks_.front());
+      tasks_.pop();
+      active_++;
+    }
+    task();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      active_--;
+      if (tasks_.empty() && active_ == 0) done_.notify_all();
+    }
+  }
+}
+
+void ThreadPool::ParallelFor(
+    std::size_t count, const std::function<void(std::size_t, int)>& task) {
+  std::atomic<std::size_t> next(0);
+  int threads = static_cast<int>(std::min<std::size_t>(Size(), count));
+  //  ожидание только своих задач: пул может быть занят и чужими
+  std::mutex mutex;
+  std::condition_variable finished;
+  int remaining = threads;
+  for (int worker = 0; worker < threads; worker++) {
+    Submit([&, count, worker] {
+      for (std::size_t i = next++; i < count; i = next++) task(i, worker);
+      std::lock_guard<std::mutex> lock(mutex);
+      if (--remaining == 0) finished.notify_one();
+    });
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  finished.wait(lock, [&remaining] { return remaining == 0; });
+}
+
+}  // namespace s21
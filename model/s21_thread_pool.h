@@ -0,0 +1,66 @@
+#ifndef SRC_MODEL_S21_THREAD_POOL_H_
+#define SRC_MODEL_S21_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * Пул потоков с общей очередью задач
+ */
+class ThreadPool {
+ public:
+  /**
+   * Конструктор
+   * @param threads - число потоков, 0 - по числу ядер
+   */
+  explicit ThreadPool(int threads = 0);
+  /**
+   * Деструктор, дожидается выполнения всех задач
+   */
+  ~ThreadPool();
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * Метод получения числа потоков
+   */
+  int Size() const { return static_cast<int>(workers_.size()); }
+  /**
+   * Метод добавления задачи в очередь
+   * @param task - задача
+   */
+  void Submit(std::function<void()> task);
+  /**
+   * Метод ожидания выполнения всех задач очереди
+   */
+  void Wait();
+  /**
+   * Метод параллельного выполнения count задач. Каждый поток получает
+   * свой номер, чтобы пользоваться своими рабочими буферами. Нельзя
+   * вызывать из задач самого пула
+   * @param count - число задач
+   * @param task - задача, принимает номер задачи и номер потока
+   */
+  void ParallelFor(std::size_t count,
+                   const std::function<void(std::size_t, int)>& task);
+
+ private:
+  void Work();
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable ready_, done_;
+  std::size_t active_ = 0;
+  bool stop_ = false;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_THREAD_POOL_H_
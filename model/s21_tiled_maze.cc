@@ -0,0 +1,238 @@
+#include "s21_tiled_maze.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "s21_maze_io.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr char kMagic[8] = {'S', '2', '1', 'T', 'I', 'L', 'E', '\0'};
+constexpr std::uint32_t kVersion = 1;
+//  плитки начинаются с этого смещения и выровнены по нему
+constexpr std::uint64_t kAlign = 4096;
+
+struct Header {
+  char magic[8];
+  std::uint32_t version;
+  std::int32_t rows;
+  std::int32_t cols;
+  std::int32_t tile;
+  std::uint64_t tile_bytes;
+};
+
+std::size_t RowWords(int tile) { return (tile + 63) / 64; }
+
+std::uint64_t TileBytes(int tile) {
+  std::uint64_t bytes = 2 * tile * RowWords(tile) * sizeof(std::uint64_t);
+  return (bytes + kAlign - 1) / kAlign * kAlign;
+}
+
+std::uint64_t TileCount(int rows, int cols, int tile) {
+  return static_cast<std::uint64_t>((rows + tile - 1) / tile) *
+         ((cols + tile - 1) / tile);
+}
+
+bool WriteAll(int fd, const void* data, std::size_t size, off_t offset) {
+  const char* bytes = static_cast<const char*>(data);
+  while (size > 0) {
+    ssize_t written = pwrite(fd, bytes, size, offset);
+    if (written <= 0) return false;
+    bytes += written;
+    size -= written;
+    offset += written;
+  }
+  return true;
+}
+
+//  источник строк стен: part 0 - стены справа, 1 - стены снизу
+using RowSource = std::function<bool(int part, int row, int* values)>;
+
+//  запись лабиринта по полосам плиток: строки копятся в полосе высотой в
+//  одну плитку, затем каждая плитка полосы пишется на свое место
+bool WriteTiles(const std::string& filename, int rows, int cols, int tile,
+                const RowSource& source) {
+  if (rows <= 0 || cols <= 0 || tile <= 0) return false;
+  int fd = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) return false;
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.rows = rows;
+  header.cols = cols;
+  header.tile = tile;
+  header.tile_bytes = TileBytes(tile);
+  bool ok = ftruncate(fd, kAlign + TileCount(rows, cols, tile) *
+                                       header.tile_bytes) == 0 &&
+            WriteAll(fd, &header, sizeof(header), 0);
+
+  int tile_cols = (cols + tile - 1) / tile;
+  std::size_t row_words = RowWords(tile);
+  std::size_t part_words = tile * row_words;
+  std::vector<std::uint64_t> band(tile_cols * part_words);
+  std::vector<int> values(cols);
+  for (int part = 0; part < 2 && ok; part++) {
+    for (int row = 0; row < rows && ok; row++) {
+      if (row % tile == 0) std::fill(band.begin(), band.end(), 0);
+      ok = source(part, row, values.data());
+      for (int col = 0; col < cols && ok; col++) {
+        if (!values[col]) continue;
+        int local = col % tile;
+        band[col / tile * part_words + row % tile * row_words + local / 64] |=
+            std::uint64_t{1} << (local % 64);
+      }
+      if (row % tile != tile - 1 && row != rows - 1) continue;
+      for (int tc = 0; tc < tile_cols && ok; tc++) {
+        std::uint64_t id =
+            static_cast<std::uint64_t>(row / tile) * tile_cols + tc;
+        ok = WriteAll(fd, band.data() + tc * part_words,
+                      part_words * sizeof(std::uint64_t),
+                      kAlign + id * header.tile_bytes +
+                          part * part_words * sizeof(std::uint64_t));
+      }
+    }
+  }
+  ok = close(fd) == 0 && ok;
+  return ok;
+}
+
+}  // namespace
+
+TiledMaze::TiledMaze() {}
+
+TiledMaze::~TiledMaze() { Close(); }
+
+bool TiledMaze::Write(const std::string& filename, const WallMatrix& right,
+                      const WallMatrix& bottom, int tile) {
+  int rows = right.size();
+  int cols = rows ? right[0].size() : 0;
+  return WriteTiles(filename, rows, cols, tile,
+                    [&](int part, int row, int* values) {
+                      const auto& matrix = part ? bottom : right;
+                      std::copy(matrix[row].begin(), matrix[row].end(),
+                                values);
+                      return true;
+                    });
+}
+
+bool TiledMaze::Convert(const std::string& maze_filename,
+                        const std::string& filename, int tile) {
+  try {
+    std::unique_ptr<InputStream> file = OpenInput(maze_filename);
+    if (!file) return false;
+    TokenReader reader(file.get());
+    int rows = 0, cols = 0;
+    if (!reader.NextInt(&rows) || !reader.NextInt(&cols)) return false;
+    return WriteTiles(filename, rows, cols, tile,
+                      [&reader, cols](int, int, int* values) {
+                        for (int col = 0; col < cols; col++) {
+                          if (!reader.NextInt(values + col)) return false;
+                        }
+                        return true;
+                      });
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+}
+
+bool TiledMaze::Open(const std::string& filename, std::size_t cache_tiles) {
+  Close();
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  Header header{};
+  struct stat st;
+  bool ok = pread(fd, &header, sizeof(header), 0) ==
+                static_cast<ssize_t>(sizeof(header)) &&
+            std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+            header.version == kVersion && header.rows > 0 && header.cols > 0 &&
+            header.tile > 0 && header.tile_bytes == TileBytes(header.tile) &&
+            fstat(fd, &st) == 0 &&
+            static_cast<std::uint64_t>(st.st_size) >=
+                kAlign + TileCount(header.rows, header.cols, header.tile) *
+                             header.tile_bytes;
+  if (!ok) {
+    close(fd);
+    return false;
+  }
+  fd_ = fd;
+  rows_ = header.rows;
+  cols_ = header.cols;
+  tile_ = header.tile;
+  tile_cols_ = (cols_ + tile_ - 1) / tile_;
+  row_words_ = RowWords(tile_);
+  tile_bytes_ = header.tile_bytes;
+  capacity_ = cache_tiles ? cache_tiles : 1;
+  loads_ = 0;
+  hits_ = 0;
+  return true;
+}
+
+void TiledMaze::Close() {
+  while (!slots_.empty()) Evict();
+  if (fd_ >= 0) close(fd_);
+  fd_ = -1;
+  rows_ = 0;
+  cols_ = 0;
+  tile_ = 0;
+  last_ = nullptr;
+}
+
+bool TiledMaze::Bit(int part, int row, int col) {
+  const std::uint64_t* words =
+      Tile(static_cast<std::uint64_t>(row / tile_) * tile_cols_ + col / tile_);
+  int local = col % tile_;
+  return (words[(part * tile_ + row % tile_) * row_words_ + local / 64] >>
+          (local % 64)) &
+         1;
+}
+
+const std::uint64_t* TiledMaze::Tile(std::uint64_t id) {
+  if (last_ && id == last_id_) {
+    hits_++;
+    return last_;
+  }
+  auto found = lookup_.find(id);
+  if (found != lookup_.end()) {
+    slots_.splice(slots_.begin(), slots_, found->second);
+    hits_++;
+  } else {
+    if (slots_.size() >= capacity_) Evict();
+    //  смещение отображения должно быть кратно размеру страницы системы
+    std::uint64_t offset = kAlign + id * tile_bytes_;
+    std::uint64_t page = sysconf(_SC_PAGESIZE);
+    std::uint64_t aligned = offset / page * page;
+    std::size_t map_size = tile_bytes_ + (offset - aligned);
+    void* map = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fd_, aligned);
+    if (map == MAP_FAILED) {
+      throw std::runtime_error("Не удалось отобразить плитку лабиринта.");
+    }
+    const std::uint64_t* words = reinterpret_cast<const std::uint64_t*>(
+        static_cast<const char*>(map) + (offset - aligned));
+    slots_.push_front({id, map, map_size, words});
+    lookup_[id] = slots_.begin();
+    loads_++;
+  }
+  last_id_ = id;
+  last_ = slots_.front().words;
+  return last_;
+}
+
+void TiledMaze::Evict() {
+  const Slot& slot = slots_.back();
+  munmap(slot.map, slot.map_size);
+  lookup_.erase(slot.id);
+  if (last_ == slot.words) last_ = nullptr;
+  slots_.pop_back();
+}
+
+}  // namespace s21
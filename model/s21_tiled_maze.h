@@ -0,0 +1,149 @@
+#ifndef SRC_MODEL_S21_TILED_MAZE_H_
+#define SRC_MODEL_S21_TILED_MAZE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "s21_memory.h"
+
+namespace s21 {
+
+/**
+ * Лабиринт на диске, разбитый на квадратные плитки. Каждая плитка хранит
+ * упакованные по битам стены справа и снизу своих клеток и выровнена по
+ * странице, поэтому отображается в память отдельно от остальных. В памяти
+ * держится не больше заданного числа плиток, давно не использованные
+ * плитки вытесняются
+ */
+class TiledMaze {
+ public:
+  /**
+   * Сторона плитки по умолчанию
+   */
+  static constexpr int kDefaultTile = 256;
+  /**
+   * Число плиток в памяти по умолчанию
+   */
+  static constexpr std::size_t kDefaultCacheTiles = 64;
+
+  /**
+   * Конструктор
+   */
+  TiledMaze();
+  /**
+   * Деструктор, снимает отображение плиток и закрывает файл
+   */
+  ~TiledMaze();
+  TiledMaze(const TiledMaze&) = delete;
+  TiledMaze& operator=(const TiledMaze&) = delete;
+
+  /**
+   * Метод записи лабиринта из памяти в файл плиток
+   * @param filename - имя файла плиток
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param tile - сторона плитки
+   * @return - успешна ли запись
+   */
+  static bool Write(const std::string& filename, const WallMatrix& right,
+                    const WallMatrix& bottom, int tile = kDefaultTile);
+  /**
+   * Метод перевода текстового файла лабиринта в файл плиток. Текст
+   * читается потоком, в памяти держится одна полоса плиток
+   * @param maze_filename - имя текстового файла лабиринта
+   * @param filename - имя файла плиток
+   * @param tile - сторона плитки
+   * @return - успешен ли перевод
+   */
+  static bool Convert(const std::string& maze_filename,
+                      const std::string& filename, int tile = kDefaultTile);
+  /**
+   * Метод открытия файла плиток
+   * @param filename - имя файла плиток
+   * @param cache_tiles - наибольшее число плиток в памяти
+   * @return - удалось ли открыть файл
+   */
+  bool Open(const std::string& filename,
+            std::size_t cache_tiles = kDefaultCacheTiles);
+  /**
+   * Метод закрытия файла
+   */
+  void Close();
+  /**
+   * Метод проверки, открыт ли файл
+   */
+  bool IsOpen() const { return fd_ >= 0; }
+  /**
+   * Метод получения числа строк лабиринта
+   */
+  int GetRows() const { return rows_; }
+  /**
+   * Метод получения числа столбцов лабиринта
+   */
+  int GetCols() const { return cols_; }
+  /**
+   * Метод получения стороны плитки
+   */
+  int GetTileSize() const { return tile_; }
+  /**
+   * Метод проверки стены справа от клетки
+   */
+  bool HasRightWall(int row, int col) { return Bit(0, row, col); }
+  /**
+   * Метод проверки стены снизу от клетки
+   */
+  bool HasBottomWall(int row, int col) { return Bit(1, row, col); }
+  /**
+   * Метод получения числа загрузок плиток в память с момента открытия
+   */
+  std::uint64_t GetLoads() const { return loads_; }
+  /**
+   * Метод получения числа обращений к плиткам, уже бывшим в памяти
+   */
+  std::uint64_t GetHits() const { return hits_; }
+
+ protected:
+  /**
+   * Метод получения бита стены клетки
+   * @param part - 0 для стен справа, 1 для стен снизу
+   */
+  bool Bit(int part, int row, int col);
+  /**
+   * Метод получения слов плитки, при отсутствии в памяти плитка
+   * отображается из файла
+   * @param id - номер плитки
+   */
+  const std::uint64_t* Tile(std::uint64_t id);
+
+ private:
+  struct Slot {
+    std::uint64_t id;
+    void* map;
+    std::size_t map_size;
+    const std::uint64_t* words;
+  };
+
+  void Evict();
+
+  int fd_ = -1;
+  int rows_ = 0;
+  int cols_ = 0;
+  int tile_ = 0;
+  int tile_cols_ = 0;
+  std::size_t row_words_ = 0;
+  std::uint64_t tile_bytes_ = 0;
+  std::size_t capacity_ = 0;
+  std::list<Slot> slots_;
+  std::unordered_map<std::uint64_t, std::list<Slot>::iterator> lookup_;
+  std::uint64_t last_id_ = 0;
+  const std::uint64_t* last_ = nullptr;
+  std::uint64_t loads_ = 0;
+  std::uint64_t hits_ = 0;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_TILED_MAZE_H_
@@ -0,0 +1,172 @@
+#include "s21_tiled_solver.h"
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace s21 {
+
+namespace {
+
+//  два бита на клетку: 0 - не посещена, иначе расстояние по модулю 3 плюс 1
+class LabelPlane {
+ public:
+  LabelPlane(std::uint64_t cells, const std::string& directory,
+             std::uint64_t limit) {
+    std::uint64_t words = (cells + 31) / 32;
+    if (words * sizeof(std::uint64_t) <= limit) {
+      memory_.assign(words, 0);
+      words_ = memory_.data();
+      return;
+    }
+    std::string path = directory + "/s21_labels_XXXXXX";
+    int fd = mkstemp(path.data());
+    if (fd < 0) throw std::runtime_error("Не удалось создать временный файл.");
+    unlink(path.c_str());
+    size_ = words * sizeof(std::uint64_t);
+    void* map = MAP_FAILED;
+    if (ftruncate(fd, size_) == 0) {
+      map = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (map == MAP_FAILED) {
+      throw std::runtime_error("Не удалось отобразить временный файл.");
+    }
+    map_ = map;
+    words_ = static_cast<std::uint64_t*>(map);
+  }
+  ~LabelPlane() {
+    if (map_) munmap(map_, size_);
+  }
+  LabelPlane(const LabelPlane&) = delete;
+  LabelPlane& operator=(const LabelPlane&) = delete;
+
+  bool IsSpilled() const { return map_ != nullptr; }
+  int Get(std::uint64_t cell) const {
+    return (words_[cell / 32] >> (cell % 32 * 2)) & 3;
+  }
+  void Set(std::uint64_t cell, int label) {
+    words_[cell / 32] |= static_cast<std::uint64_t>(label) << (cell % 32 * 2);
+  }
+
+ private:
+  std::vector<std::uint64_t> memory_;
+  void* map_ = nullptr;
+  std::size_t size_ = 0;
+  std::uint64_t* words_ = nullptr;
+};
+
+std::uint64_t PageFaults() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_minflt + usage.ru_majflt;
+}
+
+int Label(std::uint64_t dist) { return dist % 3 + 1; }
+
+}  // namespace
+
+void TiledSolver::SetSpill(const std::string& directory,
+                           std::uint64_t resident_limit) {
+  spill_directory_ = directory;
+  resident_limit_ = resident_limit;
+}
+
+std::vector<Point> TiledSolver::Solve(TiledMaze* maze, const Point& start,
+                                      const Point& end) {
+  int rows = maze->GetRows(), cols = maze->GetCols();
+  auto inside = [rows, cols](const Point& p) {
+    return p.row >= 0 && p.col >= 0 && p.row < rows && p.col < cols;
+  };
+  if (!maze->IsOpen() || !inside(start) || !inside(end)) {
+    throw std::invalid_argument("Неверные координаты точек.");
+  }
+  std::uint64_t loads = maze->GetLoads();
+  std::uint64_t faults = PageFaults();
+
+  std::uint64_t source = static_cast<std::uint64_t>(start.row) * cols + start.col;
+  std::uint64_t target = static_cast<std::uint64_t>(end.row) * cols + end.col;
+  LabelPlane labels(static_cast<std::uint64_t>(rows) * cols, spill_directory_,
+                    resident_limit_);
+  spilled_ = labels.IsSpilled();
+
+  //  обход по уровням, клетки уровня упорядочены по плиткам, чтобы каждая
+  //  плитка загружалась за уровень не больше одного раза
+  int tile = maze->GetTileSize();
+  int tile_cols = (cols + tile - 1) / tile;
+  auto tile_of = [cols, tile, tile_cols](std::uint64_t cell) {
+    return cell / cols / tile * tile_cols + cell % cols / tile;
+  };
+  std::vector<std::uint64_t> frontier = {source}, next;
+  labels.Set(source, Label(0));
+  std::uint64_t dist = 0;
+  while (!frontier.empty() && !labels.Get(target)) {
+    std::sort(frontier.begin(), frontier.end(),
+              [&tile_of](std::uint64_t a, std::uint64_t b) {
+                std::uint64_t ta = tile_of(a), tb = tile_of(b);
+                return ta != tb ? ta < tb : a < b;
+              });
+    int label = Label(dist + 1);
+    auto visit = [&labels, &next, label](std::uint64_t cell) {
+      labels.Set(cell, label);
+      next.push_back(cell);
+    };
+    next.clear();
+    for (std::uint64_t cell : frontier) {
+      int row = cell / cols, col = cell % cols;
+      if (col < cols - 1 && !labels.Get(cell + 1) &&
+          !maze->HasRightWall(row, col)) {
+        visit(cell + 1);
+      }
+      if (col > 0 && !labels.Get(cell - 1) &&
+          !maze->HasRightWall(row, col - 1)) {
+        visit(cell - 1);
+      }
+      if (row > 0 && !labels.Get(cell - cols) &&
+          !maze->HasBottomWall(row - 1, col)) {
+        visit(cell - cols);
+      }
+      if (row < rows - 1 && !labels.Get(cell + cols) &&
+          !maze->HasBottomWall(row, col)) {
+        visit(cell + cols);
+      }
+    }
+    frontier.swap(next);
+    dist++;
+  }
+
+  //  восстановление пути: у соседа на кратчайшем пути метка на 1 меньше
+  std::vector<Point> path;
+  if (labels.Get(target)) {
+    std::vector<std::uint64_t>().swap(frontier);
+    std::vector<std::uint64_t>().swap(next);
+    path.reserve(dist + 1);
+    path.push_back(end);
+    for (std::uint64_t cell = target; cell != source; dist--) {
+      int row = cell / cols, col = cell % cols;
+      int label = Label(dist - 1);
+      if (col < cols - 1 && labels.Get(cell + 1) == label &&
+          !maze->HasRightWall(row, col)) {
+        cell++;
+      } else if (col > 0 && labels.Get(cell - 1) == label &&
+                 !maze->HasRightWall(row, col - 1)) {
+        cell--;
+      } else if (row > 0 && labels.Get(cell - cols) == label &&
+                 !maze->HasBottomWall(row - 1, col)) {
+        cell -= cols;
+      } else {
+        cell += cols;
+      }
+      path.push_back({static_cast<int>(cell / cols),
+                      static_cast<int>(cell % cols)});
+    }
+  }
+  tile_loads_ = maze->GetLoads() - loads;
+  page_faults_ = PageFaults() - faults;
+  return path;
+}
+
+}  // namespace s21
@@ -0,0 +1,66 @@
+#ifndef SRC_MODEL_S21_TILED_SOLVER_H_
+#define SRC_MODEL_S21_TILED_SOLVER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "s21_point.h"
+#include "s21_tiled_maze.h"
+
+namespace s21 {
+
+/**
+ * Поиск пути в лабиринте, который хранится на диске плитками. Стены
+ * читаются через кэш плиток TiledMaze, в памяти держатся только фронт
+ * обхода и по два бита на клетку: расстояние от начальной точки по
+ * модулю 3, по которому восстанавливается путь. Если эти биты больше
+ * заданного предела, они хранятся в отображенном временном файле
+ */
+class TiledSolver {
+ public:
+  /**
+   * Предел памяти под биты клеток по умолчанию, 256 МиБ
+   */
+  static constexpr std::uint64_t kDefaultResidentLimit = std::uint64_t{1}
+                                                         << 28;
+
+  /**
+   * Метод настройки вытеснения битов клеток на диск
+   * @param directory - каталог для временного файла
+   * @param resident_limit - наибольший размер битов клеток в памяти
+   */
+  void SetSpill(const std::string& directory, std::uint64_t resident_limit);
+  /**
+   * Метод поиска кратчайшего пути
+   * @param maze - открытый лабиринт из плиток
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь в формате Model::GetPath, пустой если пути нет
+   */
+  std::vector<Point> Solve(TiledMaze* maze, const Point& start,
+                           const Point& end);
+  /**
+   * Метод получения числа загрузок плиток за последний поиск
+   */
+  std::uint64_t GetTileLoads() const { return tile_loads_; }
+  /**
+   * Метод получения числа страничных прерываний процесса за последний
+   * поиск
+   */
+  std::uint64_t GetPageFaults() const { return page_faults_; }
+  /**
+   * Метод проверки, хранились ли биты клеток последнего поиска на диске
+   */
+  bool IsSpilled() const { return spilled_; }
+
+ private:
+  std::string spill_directory_ = "/tmp";
+  std::uint64_t resident_limit_ = kDefaultResidentLimit;
+  std::uint64_t tile_loads_ = 0;
+  std::uint64_t page_faults_ = 0;
+  bool spilled_ = false;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_TILED_SOLVER_H_
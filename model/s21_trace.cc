@@ -0,0 +1,129 @@
+#include "s21_trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace s21 {
+
+namespace {
+
+std::int64_t ClockNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+//  имена интервалов - литералы из кода, но кавычки и управляющие символы
+//  все равно экранируются, чтобы файл оставался корректным JSON
+void WriteName(std::FILE* file, const char* name) {
+  std::fputc('"', file);
+  for (const char* c = name; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      std::fprintf(file, "\\%c", *c);
+    } else if (static_cast<unsigned char>(*c) < 0x20) {
+      std::fprintf(file, "\\u%04x", static_cast<unsigned>(*c));
+    } else {
+      std::fputc(*c, file);
+    }
+  }
+  std::fputc('"', file);
+}
+
+}  // namespace
+
+void TraceBuffer::Collect(std::vector<TraceEvent>* events) const {
+  std::uint64_t head = head_.load(std::memory_order_acquire);
+  std::uint64_t first = head > kCapacity ? head - kCapacity : 0;
+  for (std::uint64_t i = first; i < head; i++) {
+    const Slot& slot = slots_[i & (kCapacity - 1)];
+    std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != 2 * i + 2) continue;
+    TraceEvent event;
+    event.name = slot.name.load(std::memory_order_relaxed);
+    event.start = slot.start.load(std::memory_order_relaxed);
+    event.duration = slot.duration.load(std::memory_order_relaxed);
+    event.thread = thread_;
+    //  слот могли перезаписать во время чтения
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != sequence) continue;
+    events->push_back(event);
+  }
+}
+
+Tracer::Tracer() : epoch_(ClockNs()) {}
+
+Tracer& Tracer::Instance() {
+  //  трассировщик не удаляется: интервалы могут закрываться в
+  //  деструкторах статических объектов и в еще работающих потоках
+  static Tracer* tracer = new Tracer;
+  return *tracer;
+}
+
+std::uint64_t Tracer::Now() const { return ClockNs() - epoch_; }
+
+TraceBuffer& Tracer::GetThreadBuffer() {
+  thread_local TraceBuffer* buffer = nullptr;
+  if (!buffer) {
+    buffer = new TraceBuffer(threads_.fetch_add(1));
+    TraceBuffer* next = buffers_.load(std::memory_order_relaxed);
+    do {
+      buffer->next_ = next;
+    } while (!buffers_.compare_exchange_weak(next, buffer,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+  }
+  return *buffer;
+}
+
+std::vector<TraceEvent> Tracer::Collect() const {
+  std::vector<TraceEvent> events;
+  for (const TraceBuffer* buffer = buffers_.load(std::memory_order_acquire);
+       buffer; buffer = buffer->next_) {
+    buffer->Collect(&events);
+  }
+  //  при равном начале внешний интервал идет раньше вложенного
+  std::sort(events.begin(), events.end(),
+            [](const TraceEvent& a, const TraceEvent& b) {
+              if (a.start != b.start) return a.start < b.start;
+              return a.duration > b.duration;
+            });
+  return events;
+}
+
+bool Tracer::Dump(const std::string& filename) const {
+  std::vector<TraceEvent> events = Collect();
+  std::FILE* file = std::fopen(filename.c_str(), "wb");
+  if (!file) return false;
+  std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+  const char* separator = "\n";
+  int threads = threads_.load();
+  for (int thread = 0; thread < threads; thread++) {
+    std::fprintf(file,
+                 "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                 "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                 separator, thread, thread);
+    separator = ",\n";
+  }
+  //  время в формате Chrome trace - микросекунды
+  for (const TraceEvent& event : events) {
+    std::fprintf(file, "%s{\"name\":", separator);
+    WriteName(file, event.name);
+    std::fprintf(file,
+                 ",\"cat\":\"maze\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                 "\"ts\":%.3f,\"dur\":%.3f}",
+                 event.thread, event.start / 1000.0, event.duration / 1000.0);
+    separator = ",\n";
+  }
+  std::fprintf(file, "]}\n");
+  bool ok = !std::ferror(file);
+  return std::fclose(file) == 0 && ok;
+}
+
+std::string Tracer::GetDumpName() {
+  const char* name = std::getenv("S21_TRACE_FILE");
+  return name && *name ? name : "maze_trace.json";
+}
+
+}  // namespace s21
@@ -0,0 +1,196 @@
+#ifndef SRC_MODEL_S21_TRACE_H_
+#define SRC_MODEL_S21_TRACE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * Завершенный интервал трассировки
+ */
+struct TraceEvent {
+  /**
+   * Имя интервала, строковый литерал
+   */
+  const char* name = nullptr;
+  /**
+   * Начало в наносекундах от запуска трассировки
+   */
+  std::uint64_t start = 0;
+  /**
+   * Длительность в наносекундах
+   */
+  std::uint64_t duration = 0;
+  /**
+   * Номер потока
+   */
+  int thread = 0;
+};
+
+/**
+ * Кольцевой буфер интервалов одного потока. Пишет только поток-владелец,
+ * без блокировок: запись заполняется, затем публикуется сдвигом головы.
+ * Читать можно из любого потока, записи, перезаписанные во время чтения,
+ * отбрасываются. При переполнении теряются самые старые интервалы
+ */
+class TraceBuffer {
+ public:
+  /**
+   * Число интервалов в буфере, степень двойки
+   */
+  static constexpr std::size_t kCapacity = 1 << 14;
+
+  /**
+   * Конструктор
+   * @param thread - номер потока-владельца
+   */
+  explicit TraceBuffer(int thread) : thread_(thread) {}
+  TraceBuffer(const TraceBuffer&) = delete;
+  TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+  /**
+   * Метод добавления интервала, вызывается только потоком-владельцем
+   * @param name - имя интервала, строковый литерал
+   * @param start - начало в наносекундах
+   * @param duration - длительность в наносекундах
+   */
+  void Push(const char* name, std::uint64_t start, std::uint64_t duration) {
+    std::uint64_t head = head_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[head & (kCapacity - 1)];
+    //  начало и окончание записи слота видны читателю через счетчик
+    //  записей: нечетный счетчик означает, что слот пишется
+    slot.sequence.store(2 * head + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(start, std::memory_order_relaxed);
+    slot.duration.store(duration, std::memory_order_relaxed);
+    slot.sequence.store(2 * head + 2, std::memory_order_release);
+    head_.store(head + 1, std::memory_order_release);
+  }
+  /**
+   * Метод копирования интервалов буфера
+   * @param events - интервалы дописываются в конец
+   */
+  void Collect(std::vector<TraceEvent>* events) const;
+  /**
+   * Метод получения числа интервалов, записанных за все время
+   */
+  std::uint64_t GetPushed() const {
+    return head_.load(std::memory_order_acquire);
+  }
+  /**
+   * Метод получения номера потока-владельца
+   */
+  int GetThread() const { return thread_; }
+
+ private:
+  friend class Tracer;
+
+  struct Slot {
+    std::atomic<std::uint64_t> sequence{0};
+    std::atomic<const char*> name{nullptr};
+    std::atomic<std::uint64_t> start{0};
+    std::atomic<std::uint64_t> duration{0};
+  };
+
+  int thread_;
+  std::atomic<std::uint64_t> head_{0};
+  Slot slots_[kCapacity];
+  //  следующий буфер в списке буферов трассировщика
+  TraceBuffer* next_ = nullptr;
+};
+
+/**
+ * Трассировщик: собирает интервалы всех потоков и сохраняет их в формате
+ * Chrome trace JSON, который открывают Perfetto и about:tracing. Буфер
+ * потока создается при первом интервале и добавляется в список без
+ * блокировок. Буферы и сам трассировщик не удаляются до конца программы,
+ * поэтому интервалы завершившихся потоков тоже попадают в файл
+ */
+class Tracer {
+ public:
+  /**
+   * Метод получения единственного трассировщика
+   */
+  static Tracer& Instance();
+  /**
+   * Метод получения текущего времени трассировки в наносекундах
+   */
+  std::uint64_t Now() const;
+  /**
+   * Метод получения буфера текущего потока
+   */
+  TraceBuffer& GetThreadBuffer();
+  /**
+   * Метод получения интервалов всех потоков, упорядоченных по началу
+   */
+  std::vector<TraceEvent> Collect() const;
+  /**
+   * Метод записи интервалов в формате Chrome trace JSON
+   * @param filename - имя файла
+   * @return - удалось ли записать файл
+   */
+  bool Dump(const std::string& filename) const;
+  /**
+   * Метод получения имени файла трассировки: переменная окружения
+   * S21_TRACE_FILE или maze_trace.json
+   */
+  static std::string GetDumpName();
+
+ private:
+  Tracer();
+  Tracer(const Tracer&) = delete;
+  Tracer& operator=(const Tracer&) = delete;
+
+  std::int64_t epoch_;
+  std::atomic<TraceBuffer*> buffers_{nullptr};
+  std::atomic<int> threads_{0};
+};
+
+/**
+ * Интервал трассировки на время жизни объекта
+ */
+class TraceSpan {
+ public:
+  /**
+   * Конструктор, начинает интервал
+   * @param name - имя интервала, строковый литерал
+   */
+  explicit TraceSpan(const char* name)
+      : name_(name), start_(Tracer::Instance().Now()) {}
+  /**
+   * Деструктор, записывает интервал в буфер потока
+   */
+  ~TraceSpan() {
+    Tracer& tracer = Tracer::Instance();
+    tracer.GetThreadBuffer().Push(name_, start_, tracer.Now() - start_);
+  }
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+ private:
+  const char* name_;
+  std::uint64_t start_;
+};
+
+}  // namespace s21
+
+//  Трассировка включается флагом S21_WITH_TRACE (make WITH_TRACE=1 или
+//  qmake CONFIG+=trace), без него макросы не порождают кода
+#ifdef S21_WITH_TRACE
+#define S21_TRACE_CONCAT_(a, b) a##b
+#define S21_TRACE_CONCAT(a, b) S21_TRACE_CONCAT_(a, b)
+#define S21_TRACE_SCOPE(name) \
+  ::s21::TraceSpan S21_TRACE_CONCAT(s21_trace_span_, __LINE__)(name)
+#define S21_TRACE_DUMP() \
+  ::s21::Tracer::Instance().Dump(::s21::Tracer::GetDumpName())
+#else
+#define S21_TRACE_SCOPE(name) static_cast<void>(0)
+#define S21_TRACE_DUMP() static_cast<void>(0)
+#endif
+
+#endif  // SRC_MODEL_S21_TRACE_H_
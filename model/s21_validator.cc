@@ -0,0 +1,120 @@
+#include "s21_validator.h"
+
+#include <numeric>
+
+namespace s21 {
+
+int MazeValidator::Find(int cell) {
+  while (parent_[cell] != cell) {
+    parent_[cell] = parent_[parent_[cell]];
+    cell = parent_[cell];
+  }
+  return cell;
+}
+
+bool MazeValidator::Unite(int a, int b) {
+  a = Find(a);
+  b = Find(b);
+  if (a == b) return false;
+  if (size_[a] < size_[b]) std::swap(a, b);
+  parent_[b] = a;
+  size_[a] += size_[b];
+  return true;
+}
+
+MazeValidation MazeValidator::Validate(const WallMatrix& right,
+                                       const WallMatrix& bottom) {
+  MazeValidation result;
+  int rows = right.size();
+  int cols = rows ? right[0].size() : 0;
+  parent_.resize(rows * cols);
+  size_.assign(rows * cols, 1);
+  std::iota(parent_.begin(), parent_.end(), 0);
+
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      int cell = i * cols + j;
+      if (j < cols - 1 && !right[i][j] && !Unite(cell, cell + 1)) {
+        result.has_loops = true;
+      }
+      if (i < rows - 1 && !bottom[i][j] && !Unite(cell, cell + cols)) {
+        result.has_loops = true;
+      }
+    }
+    if (cols && !right[i][cols - 1]) result.open_right_edge = true;
+  }
+  for (int j = 0; rows && j < cols; j++) {
+    if (!bottom[rows - 1][j]) result.open_bottom_edge = true;
+  }
+
+  //  нумерация компонент по порядку первого появления
+  result.component.assign(rows * cols, -1);
+  for (int cell = 0; cell < rows * cols; cell++) {
+    int root = Find(cell);
+    if (result.component[root] < 0) {
+      result.component[root] = result.components++;
+      result.component_sizes.push_back(size_[root]);
+    }
+    result.component[cell] = result.component[root];
+  }
+
+  if (result.components > 1) {
+    result.kind = MazeValidation::Kind::kDisconnected;
+  } else if (result.has_loops) {
+    result.kind = MazeValidation::Kind::kLooped;
+  }
+  return result;
+}
+
+int MazeValidator::Repair(WallMatrix* right, WallMatrix* bottom) {
+  auto& r = *right;
+  auto& b = *bottom;
+  int rows = r.size();
+  int cols = rows ? r[0].size() : 0;
+  int changed = 0;
+  parent_.resize(rows * cols);
+  size_.assign(rows * cols, 1);
+  std::iota(parent_.begin(), parent_.end(), 0);
+
+  //  первый проход: оставляем остовный лес из открытых проходов
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      int cell = i * cols + j;
+      if (j < cols - 1 && !r[i][j] && !Unite(cell, cell + 1)) {
+        r[i][j] = 1;
+        changed++;
+      }
+      if (i < rows - 1 && !b[i][j] && !Unite(cell, cell + cols)) {
+        b[i][j] = 1;
+        changed++;
+      }
+    }
+  }
+  //  второй проход: сносим стены между разными компонентами
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      int cell = i * cols + j;
+      if (j < cols - 1 && r[i][j] && Unite(cell, cell + 1)) {
+        r[i][j] = 0;
+        changed++;
+      }
+      if (i < rows - 1 && b[i][j] && Unite(cell, cell + cols)) {
+        b[i][j] = 0;
+        changed++;
+      }
+    }
+    if (cols && !r[i][cols - 1]) {
+      r[i][cols - 1] = 1;
+      changed++;
+    }
+  }
+  for (int j = 0; rows && j < cols; j++) {
+    if (!b[rows - 1][j]) {
+      b[rows - 1][j] = 1;
+      changed++;
+    }
+  }
+  return changed;
+}
+
+}  // namespace s21
@@ -0,0 +1,101 @@
+#ifndef SRC_MODEL_S21_VALIDATOR_H_
+#define SRC_MODEL_S21_VALIDATOR_H_
+
+#include <vector>
+
+#include "s21_memory.h"
+
+namespace s21 {
+
+/**
+ * Результат проверки лабиринта
+ */
+struct MazeValidation {
+  /**
+   * Тип лабиринта
+   */
+  enum class Kind {
+    /**
+     * Идеальный: связный и без петель
+     */
+    kPerfect,
+    /**
+     * Связный, но с петлями
+     */
+    kLooped,
+    /**
+     * Несвязный (петли при этом возможны)
+     */
+    kDisconnected
+  };
+  /**
+   * Тип лабиринта
+   */
+  Kind kind = Kind::kPerfect;
+  /**
+   * Есть ли в лабиринте петли
+   */
+  bool has_loops = false;
+  /**
+   * Есть ли у последнего столбца клетки без стены справа
+   */
+  bool open_right_edge = false;
+  /**
+   * Есть ли у последней строки клетки без стены снизу
+   */
+  bool open_bottom_edge = false;
+  /**
+   * Число компонент связности
+   */
+  int components = 0;
+  /**
+   * Номер компоненты для каждой клетки (row * cols + col)
+   */
+  std::vector<int> component;
+  /**
+   * Размеры компонент
+   */
+  std::vector<int> component_sizes;
+};
+
+/**
+ * Проверка и исправление лабиринта за один проход системой
+ * непересекающихся множеств
+ */
+class MazeValidator {
+ public:
+  /**
+   * Метод проверки лабиринта
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @return - результат проверки
+   */
+  MazeValidation Validate(const WallMatrix& right, const WallMatrix& bottom);
+  /**
+   * Метод превращения лабиринта в идеальный: лишние проходы закрываются,
+   * стены между компонентами сносятся, внешние стены достраиваются
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @return - число измененных стен
+   */
+  int Repair(WallMatrix* right, WallMatrix* bottom);
+
+ protected:
+  /**
+   * Метод поиска представителя множества
+   * @param cell - номер клетки
+   */
+  int Find(int cell);
+  /**
+   * Метод объединения множеств
+   * @return - false, если клетки уже были в одном множестве
+   */
+  bool Unite(int a, int b);
+
+ private:
+  std::vector<int> parent_;
+  std::vector<int> size_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_VALIDATOR_H_
@@ -0,0 +1,118 @@
+#include "s21_weighted_solver.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace s21 {
+
+bool WeightedSolver::IsValidCosts(const CostMatrix& costs, int rows,
+                                  int cols) {
+  if (static_cast<int>(costs.size()) != rows) return false;
+  for (const auto& row : costs) {
+    if (static_cast<int>(row.size()) != cols) return false;
+    for (int cost : row) {
+      if (cost < 1 || cost > kMaxCost) return false;
+    }
+  }
+  return true;
+}
+
+WeightedPath WeightedSolver::Solve(const WallMatrix& right,
+                                   const WallMatrix& bottom,
+                                   const CostMatrix* costs, const Point& start,
+                                   const Point& end) {
+  int rows = right.size(), cols = rows ? right[0].size() : 0;
+  auto inside = [rows, cols](const Point& p) {
+    return p.row >= 0 && p.col >= 0 && p.row < rows && p.col < cols;
+  };
+  if (!inside(start) || !inside(end)) {
+    throw std::invalid_argument("Неверные координаты точек.");
+  }
+  auto cost = [costs](int row, int col) {
+    return costs ? (*costs)[row][col] : 1;
+  };
+  int max_cost = 1;
+  if (costs) {
+    for (const auto& row : *costs) {
+      max_cost = std::max(max_cost, *std::max_element(row.begin(), row.end()));
+    }
+  }
+
+  //  клетки очереди лежат в окне [d, d + max_cost], поэтому корзина d по
+  //  кругу содержит только клетки с расстоянием d или устаревшие записи
+  std::size_t count = max_cost + 1;
+  if (buckets_.size() < count) buckets_.resize(count);
+  for (auto& bucket : buckets_) bucket.clear();
+  dist_.assign(static_cast<std::size_t>(rows) * cols, -1);
+  int source = start.row * cols + start.col;
+  int target = end.row * cols + end.col;
+  dist_[source] = 0;
+  buckets_[0].push_back(source);
+  std::size_t queued = 1;
+  auto relax = [this, count, &queued](int cell, std::int64_t dist) {
+    if (dist_[cell] >= 0 && dist_[cell] <= dist) return;
+    dist_[cell] = dist;
+    buckets_[dist % count].push_back(cell);
+    queued++;
+  };
+  bool found = false;
+  for (std::int64_t d = 0; queued && !found; d++) {
+    auto& bucket = buckets_[d % count];
+    //  стоимости не меньше 1, так что текущая корзина во время обхода не
+    //  растет
+    for (int cell : bucket) {
+      if (dist_[cell] != d) continue;
+      if (cell == target) {
+        found = true;
+        break;
+      }
+      int row = cell / cols, col = cell % cols;
+      if (col < cols - 1 && !right[row][col]) {
+        relax(cell + 1, d + cost(row, col + 1));
+      }
+      if (col > 0 && !right[row][col - 1]) {
+        relax(cell - 1, d + cost(row, col - 1));
+      }
+      if (row > 0 && !bottom[row - 1][col]) {
+        relax(cell - cols, d + cost(row - 1, col));
+      }
+      if (row < rows - 1 && !bottom[row][col]) {
+        relax(cell + cols, d + cost(row + 1, col));
+      }
+    }
+    queued -= bucket.size();
+    bucket.clear();
+  }
+
+  WeightedPath result;
+  if (!found) return result;
+  result.cost = dist_[target];
+  //  обратный ход по соседям, через которых расстояние могло прийти, в
+  //  порядке Model::FindPath. Стоимости положительны, поэтому расстояние
+  //  на каждом шаге убывает
+  Point pos = end;
+  result.path.push_back(pos);
+  while (pos.row != start.row || pos.col != start.col) {
+    std::int64_t prev =
+        dist_[pos.row * cols + pos.col] - cost(pos.row, pos.col);
+    auto reached = [this, cols, prev](int row, int col) {
+      return dist_[row * cols + col] == prev;
+    };
+    if (pos.col < cols - 1 && !right[pos.row][pos.col] &&
+        reached(pos.row, pos.col + 1)) {
+      ++pos.col;
+    } else if (pos.col > 0 && !right[pos.row][pos.col - 1] &&
+               reached(pos.row, pos.col - 1)) {
+      --pos.col;
+    } else if (pos.row > 0 && !bottom[pos.row - 1][pos.col] &&
+               reached(pos.row - 1, pos.col)) {
+      --pos.row;
+    } else {
+      ++pos.row;
+    }
+    result.path.push_back(pos);
+  }
+  return result;
+}
+
+}  // namespace s21
@@ -0,0 +1,72 @@
+#ifndef SRC_MODEL_S21_WEIGHTED_SOLVER_H_
+#define SRC_MODEL_S21_WEIGHTED_SOLVER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "s21_memory.h"
+#include "s21_point.h"
+
+namespace s21 {
+
+/**
+ * Матрица стоимостей входа в клетки, хранится так же, как матрицы стен
+ */
+using CostMatrix = WallMatrix;
+
+/**
+ * Путь наименьшей стоимости
+ */
+struct WeightedPath {
+  /**
+   * Путь от конечной точки к начальной или пустой путь
+   */
+  std::vector<Point> path;
+  /**
+   * Сумма стоимостей клеток пути без начальной или -1, если пути нет
+   */
+  std::int64_t cost = -1;
+};
+
+/**
+ * Поиск пути наименьшей стоимости алгоритмом Дейкстры с очередью из
+ * корзин. Стоимости целые от 1 до kMaxCost, поэтому все клетки очереди
+ * лежат в max_cost + 1 корзинах по кругу, и извлечение минимума - это
+ * переход к следующей корзине. При единичных стоимостях корзин две, и
+ * поиск работает как обход в ширину. Рабочие буферы переиспользуются
+ */
+class WeightedSolver {
+ public:
+  /**
+   * Наибольшая стоимость клетки
+   */
+  static constexpr int kMaxCost = 65535;
+
+  /**
+   * Метод проверки матрицы стоимостей
+   * @param costs - матрица стоимостей
+   * @param rows - число строк лабиринта
+   * @param cols - число столбцов лабиринта
+   * @return - совпадают ли размеры и лежат ли стоимости в [1, kMaxCost]
+   */
+  static bool IsValidCosts(const CostMatrix& costs, int rows, int cols);
+  /**
+   * Метод поиска пути
+   * @param right - матрица стен справа
+   * @param bottom - матрица стен снизу
+   * @param costs - матрица стоимостей или nullptr для единичных стоимостей
+   * @param start - координаты начальной точки
+   * @param end - координаты конечной точки
+   * @return - путь и его стоимость
+   */
+  WeightedPath Solve(const WallMatrix& right, const WallMatrix& bottom,
+                     const CostMatrix* costs, const Point& start,
+                     const Point& end);
+
+ private:
+  std::vector<std::int64_t> dist_;
+  std::vector<std::vector<int>> buckets_;
+};
+
+}  // namespace s21
+#endif  // SRC_MODEL_S21_WEIGHTED_SOLVER_H_
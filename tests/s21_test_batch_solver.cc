@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <mutex>
+#include <random>
+
+#include "../controller/s21_controller.h"
+
+TEST(BatchSolver, SameAsGetPath) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.GenerateMaze(60, 70);
+  std::mt19937 gen(7);
+  std::vector<std::pair<s21::Point, s21::Point>> queries;
+  for (int i = 0; i < 200; i++) {
+    //  мало разных начальных точек, чтобы группы были большими
+    s21::Point start(gen() % 3, gen() % 70);
+    s21::Point end(gen() % 60, gen() % 70);
+    queries.emplace_back(start, end);
+  }
+  s21::PathBatch batch = controller.GetPaths(queries);
+  ASSERT_EQ(batch.Size(), queries.size());
+  for (std::size_t i = 0; i < queries.size(); i++) {
+    auto expected = model.GetPath(queries[i].first, queries[i].second);
+    ASSERT_EQ(batch.Length(i), expected.size());
+    for (std::size_t j = 0; j < expected.size(); j++) {
+      EXPECT_EQ(batch.Path(i)[j].row, expected[j].row);
+      EXPECT_EQ(batch.Path(i)[j].col, expected[j].col);
+    }
+  }
+}
+
+TEST(BatchSolver, Unreachable) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4disconnected.txt");
+  s21::BatchSolver solver(2);
+  s21::PathBatch batch =
+      solver.Solve(model.GetRightBorders(), model.GetBottomBorders(),
+                   {{{0, 0}, {2, 2}}, {{0, 0}, {2, 0}}, {{1, 1}, {1, 1}}});
+  ASSERT_EQ(batch.Size(), 3u);
+  EXPECT_EQ(batch.Length(0), 0u);
+  EXPECT_GT(batch.Length(1), 0u);
+  EXPECT_EQ(batch.Length(2), 1u);
+  EXPECT_EQ(batch.points.size(), batch.offsets.back());
+}
+
+TEST(BatchSolver, InvalidPoints) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile("mazes/maze4.txt");
+  EXPECT_THROW(controller.GetPaths({{{0, 0}, {4, 0}}}), std::invalid_argument);
+  EXPECT_EQ(controller.GetPaths({}).Size(), 0u);
+}
+
+TEST(ThreadPool, ParallelFor) {
+  s21::ThreadPool pool(3);
+  std::vector<int> hits(1000, 0);
+  pool.ParallelFor(hits.size(), [&hits](std::size_t i, int) { hits[i]++; });
+  EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), 1000);
+  int counter = 0;
+  std::mutex mutex;
+  for (int i = 0; i < 10; i++) {
+    pool.Submit([&] {
+      std::lock_guard<std::mutex> lock(mutex);
+      counter++;
+    });
+  }
+  pool.Wait();
+  EXPECT_EQ(counter, 10);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include "../model/s21_cave.h"
+
+namespace {
+
+//  поклеточный расчет поколения для сравнения с битовым
+std::vector<std::vector<int>> NaiveStep(
+    const std::vector<std::vector<int>>& cells, int birth, int death) {
+  int rows = cells.size(), cols = cells[0].size();
+  auto next = cells;
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      int count = 0;
+      for (int di = -1; di <= 1; di++) {
+        for (int dj = -1; dj <= 1; dj++) {
+          if (di == 0 && dj == 0) continue;
+          int r = i + di, c = j + dj;
+          bool outside = r < 0 || c < 0 || r >= rows || c >= cols;
+          count += outside ? 1 : cells[r][c];
+        }
+      }
+      if (cells[i][j] && count < death) next[i][j] = 0;
+      if (!cells[i][j] && count > birth) next[i][j] = 1;
+    }
+  }
+  return next;
+}
+
+}  // namespace
+
+TEST(Cave, ReadFromFile) {
+  s21::Cave cave;
+  cave.ReadFromFile("mazes/cave10.txt");
+  EXPECT_EQ(cave.GetCaveRows(), 10);
+  EXPECT_EQ(cave.GetCaveCols(), 10);
+  EXPECT_TRUE(cave.IsAlive(0, 0));
+  EXPECT_FALSE(cave.IsAlive(0, 1));
+  EXPECT_TRUE(cave.IsAlive(9, 9));
+}
+
+TEST(Cave, ReadFromFileThrowOpen) {
+  s21::Cave cave;
+  ASSERT_EXIT(cave.ReadFromFile("mazes/aboba.txt"),
+              ::testing::ExitedWithCode(1), "");
+}
+
+TEST(Cave, SetLimitsThrow) {
+  s21::Cave cave;
+  EXPECT_THROW(cave.SetLimits(8, 3), std::invalid_argument);
+  EXPECT_THROW(cave.SetLimits(4, -1), std::invalid_argument);
+  EXPECT_THROW(cave.GenerateCave(0, 5, 50), std::invalid_argument);
+}
+
+TEST(Cave, StepSameAsNaive) {
+  s21::Cave cave;
+  cave.ReadFromFile("mazes/cave10.txt");
+  auto expected = cave.GetCells();
+  for (int i = 0; i < 5; i++) {
+    cave.Step();
+    expected = NaiveStep(expected, 4, 3);
+    EXPECT_EQ(cave.GetCells(), expected);
+  }
+}
+
+TEST(Cave, StepThreadsSameAsNaive) {
+  s21::Cave cave;
+  cave.SetLimits(3, 2);
+  cave.SetThreads(4);
+  cave.GenerateCave(300, 130, 45);
+  auto expected = cave.GetCells();
+  for (int i = 0; i < 3; i++) {
+    cave.Step();
+    expected = NaiveStep(expected, 3, 2);
+    ASSERT_EQ(cave.GetCells(), expected);
+  }
+}
+
+TEST(Cave, RunStopsWhenStable) {
+  s21::Cave cave;
+  cave.GenerateCave(20, 20, 100);
+  EXPECT_EQ(cave.Run(10), 0);
+  cave.ReadFromFile("mazes/cave10.txt");
+  auto expected = cave.GetCells();
+  int steps = 0;
+  for (auto next = NaiveStep(expected, 4, 3); next != expected;
+       next = NaiveStep(expected, 4, 3)) {
+    expected = next;
+    steps++;
+  }
+  EXPECT_EQ(cave.Run(100), steps);
+  EXPECT_EQ(cave.GetCells(), expected);
+}
+
+TEST(Cave, SaveToFile) {
+  s21::Cave cave;
+  cave.ReadFromFile("mazes/cave10.txt");
+  cave.SaveToFile("cave_test.txt");
+  s21::Cave loaded;
+  loaded.ReadFromFile("cave_test.txt");
+  EXPECT_EQ(loaded.GetCells(), cave.GetCells());
+  std::remove("cave_test.txt");
+  cave.ClearData();
+  EXPECT_EQ(cave.GetCaveRows(), 0);
+}
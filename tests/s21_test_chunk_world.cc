@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <queue>
+
+#include "../controller/s21_controller.h"
+
+namespace {
+
+//  длина кратчайшего пути внутри прямоугольника обходом в ширину
+int WindowDistance(const s21::WallMatrix& right, const s21::WallMatrix& bottom,
+                   s21::Point start, s21::Point end) {
+  int rows = right.size(), cols = right[0].size();
+  std::vector<int> dist(rows * cols, -1);
+  std::queue<s21::Point> queue;
+  dist[start.row * cols + start.col] = 0;
+  queue.push(start);
+  while (!queue.empty()) {
+    s21::Point p = queue.front();
+    queue.pop();
+    int d = dist[p.row * cols + p.col];
+    s21::Point next[4];
+    int count = 0;
+    if (p.col < cols - 1 && !right[p.row][p.col]) {
+      next[count++] = {p.row, p.col + 1};
+    }
+    if (p.col > 0 && !right[p.row][p.col - 1]) {
+      next[count++] = {p.row, p.col - 1};
+    }
+    if (p.row > 0 && !bottom[p.row - 1][p.col]) {
+      next[count++] = {p.row - 1, p.col};
+    }
+    if (p.row < rows - 1 && !bottom[p.row][p.col]) {
+      next[count++] = {p.row + 1, p.col};
+    }
+    for (int i = 0; i < count; i++) {
+      int& seen = dist[next[i].row * cols + next[i].col];
+      if (seen >= 0) continue;
+      seen = d + 1;
+      queue.push(next[i]);
+    }
+  }
+  return dist[end.row * cols + end.col];
+}
+
+}  // namespace
+
+TEST(ChunkWorld, Deterministic) {
+  s21::ChunkWorld a(42, 8, 4), b(42, 8, 64), c(43, 8);
+  s21::WallMatrix right[3], bottom[3];
+  a.CopyWindow(-13, -21, 30, 40, &right[0], &bottom[0]);
+  b.CopyWindow(-13, -21, 30, 40, &right[1], &bottom[1]);
+  c.CopyWindow(-13, -21, 30, 40, &right[2], &bottom[2]);
+  //  повторное чтение: маленький кэш вытеснил куски, и они генерируются
+  //  снова
+  a.CopyWindow(-13, -21, 30, 40, &right[2], &bottom[2]);
+  b.CopyWindow(-13, -21, 30, 40, &right[2], &bottom[2]);
+  c.CopyWindow(-13, -21, 30, 40, &right[2], &bottom[2]);
+  EXPECT_EQ(right[0], right[1]);
+  EXPECT_EQ(bottom[0], bottom[1]);
+  EXPECT_NE(right[0], right[2]);
+  EXPECT_LE(a.GetCachedChunks(), 4u);
+  EXPECT_GT(a.GetGenerated(), b.GetGenerated());
+  EXPECT_EQ(a.HasRightWall(-13, -21), b.HasRightWall(-13, -21));
+}
+
+TEST(ChunkWorld, ChunkIsPerfectMaze) {
+  s21::ChunkWorld world(7, 16);
+  s21::WallMatrix right, bottom;
+  //  кусок с закрытыми границами - идеальный лабиринт Эллера
+  world.CopyWindow(-16, 32, 16, 16, &right, &bottom);
+  s21::MazeValidator validator;
+  EXPECT_EQ(validator.Validate(right, bottom).kind,
+            s21::MazeValidation::Kind::kPerfect);
+  //  в каждой границе куска ровно один проход
+  int right_openings = 0, bottom_openings = 0;
+  for (int i = 0; i < 16; i++) {
+    right_openings += !world.HasRightWall(-16 + i, 47);
+    bottom_openings += !world.HasBottomWall(-1, 32 + i);
+  }
+  EXPECT_EQ(right_openings, 1);
+  EXPECT_EQ(bottom_openings, 1);
+}
+
+TEST(ChunkWorld, PathAcrossChunks) {
+  s21::ChunkWorld world(3, 8, 1024);
+  s21::WorldPoint start{-5, -9}, end{20, 30};
+  auto path = world.GetPath(start, end);
+  ASSERT_FALSE(path.empty());
+  EXPECT_EQ(path.front().row, end.row);
+  EXPECT_EQ(path.front().col, end.col);
+  EXPECT_EQ(path.back().row, start.row);
+  EXPECT_EQ(path.back().col, start.col);
+  for (std::size_t i = 1; i < path.size(); i++) {
+    auto a = path[i - 1], b = path[i];
+    if (a.row == b.row) {
+      ASSERT_EQ(std::abs(a.col - b.col), 1);
+      EXPECT_FALSE(world.HasRightWall(a.row, std::min(a.col, b.col)));
+    } else {
+      ASSERT_EQ(std::abs(a.row - b.row), 1);
+      ASSERT_EQ(a.col, b.col);
+      EXPECT_FALSE(world.HasBottomWall(std::min(a.row, b.row), a.col));
+    }
+  }
+
+  //  путь A* не длиннее пути внутри большого окна вокруг точек
+  s21::WallMatrix right, bottom;
+  world.CopyWindow(-64, -64, 160, 160, &right, &bottom);
+  int window = WindowDistance(right, bottom, {-5 + 64, -9 + 64},
+                              {20 + 64, 30 + 64});
+  ASSERT_GE(window, 0);
+  EXPECT_LE(static_cast<int>(path.size()) - 1, window);
+  EXPECT_TRUE(world.GetPath(start, end, 10).empty());
+}
+
+TEST(ChunkWorld, Prefetch) {
+  s21::ChunkWorld world(5, 16, 64, 2);
+  world.Prefetch({100, -100}, 2);
+  world.Wait();
+  EXPECT_EQ(world.GetCachedChunks(), 25u);
+  EXPECT_EQ(world.GetGenerated(), 25u);
+  s21::WallMatrix right, bottom;
+  world.CopyWindow(96 - 32, -112 - 32, 80, 80, &right, &bottom);
+  EXPECT_EQ(world.GetGenerated(), 25u);
+  EXPECT_THROW(s21::ChunkWorld(1, 1), std::invalid_argument);
+}
+
+TEST(ChunkWorld, Controller) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  EXPECT_THROW(controller.ShowWorld(0, 0, 10, 10), std::runtime_error);
+  controller.OpenWorld(11, 8);
+  controller.ShowWorld(-20, 35, 12, 30);
+  EXPECT_EQ(controller.GetMazeRows(), 12);
+  EXPECT_EQ(controller.GetMazeCols(), 30);
+  s21::ChunkWorld world(11, 8);
+  EXPECT_EQ(controller.GetRightBorders()[3][4] != 0,
+            world.HasRightWall(-17, 39));
+  EXPECT_EQ(controller.GetBottomBorders()[5][7] != 0,
+            world.HasBottomWall(-15, 42));
+  auto path = controller.GetWorldPath({0, 0}, {-30, 50});
+  EXPECT_FALSE(path.empty());
+}
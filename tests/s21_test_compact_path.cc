@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "../controller/s21_controller.h"
+
+namespace {
+
+void ExpectSamePath(const std::vector<s21::Point>& a,
+                    const std::vector<s21::Point>& b) {
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < a.size(); i++) {
+    EXPECT_EQ(a[i].row, b[i].row);
+    EXPECT_EQ(a[i].col, b[i].col);
+  }
+}
+
+}  // namespace
+
+TEST(CompactPath, EncodeDecode) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  auto path = model.GetPath({2, 0}, {3, 3});
+  s21::CompactPath compact = model.GetCompactPath({2, 0}, {3, 3});
+  EXPECT_EQ(compact.Size(), path.size());
+  EXPECT_EQ(compact.Front().row, 3);
+  EXPECT_EQ(compact.Front().col, 3);
+  ExpectSamePath(compact.Decode(), path);
+  //  (3,3) -> (3,2) -> (2,2) -> (2,3) -> (0,3) -> (0,1) -> (2,1) -> (2,0),
+  //  участки короткие, и все 10 ходов пишутся по 2 бита
+  EXPECT_EQ(compact.Symbols(), 10u);
+  EXPECT_EQ(compact.Bytes(), 3u);
+}
+
+TEST(CompactPath, Runs) {
+  std::vector<s21::Point> path;
+  for (int i = 0; i < 1000; i++) path.emplace_back(0, i);
+  for (int i = 1; i < 40; i++) path.emplace_back(i, 999);
+  path.emplace_back(39, 998);
+  s21::CompactPath compact = s21::CompactPath::Encode(path);
+  //  ход и повтор 998 в 4 группах, ход и повтор 38 в 2 группах, ход
+  EXPECT_EQ(compact.Symbols(), 10u + 6u + 1u);
+  EXPECT_EQ(compact.Bytes(), 5u);
+  ExpectSamePath(compact.Decode(), path);
+
+  std::vector<s21::CompactPath::Run> runs;
+  for (const auto& run : compact.GetRuns()) runs.push_back(run);
+  ASSERT_EQ(runs.size(), 3u);
+  EXPECT_EQ(runs[0].length, 999u);
+  EXPECT_EQ(runs[0].to.col, 999);
+  EXPECT_EQ(runs[1].move, s21::CompactPath::Move::kDown);
+  EXPECT_EQ(runs[1].to.row, 39);
+  EXPECT_EQ(runs[2].move, s21::CompactPath::Move::kLeft);
+  EXPECT_EQ(runs[2].from.row, 39);
+  EXPECT_EQ(runs[2].to.col, 998);
+}
+
+TEST(CompactPath, EmptyAndSingle) {
+  s21::CompactPath empty = s21::CompactPath::Encode({});
+  EXPECT_TRUE(empty.Empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_TRUE(empty.GetRuns().begin() == empty.GetRuns().end());
+
+  s21::CompactPath single = s21::CompactPath::Encode({{4, 5}});
+  EXPECT_EQ(single.Size(), 1u);
+  EXPECT_EQ(single.Bytes(), 0u);
+  ExpectSamePath(single.Decode(), {{4, 5}});
+  EXPECT_EQ(single.Symbols(), 0u);
+  EXPECT_THROW(s21::CompactPath::Encode({{0, 0}, {1, 1}}),
+               std::invalid_argument);
+}
+
+TEST(CompactPath, Reversals) {
+  //  развороты и повторы после них, в том числе на месте экранирования
+  std::vector<s21::Point> path = {{5, 5}, {5, 6}, {5, 5}, {5, 4}, {5, 3},
+                                  {5, 2}, {5, 1}, {5, 0}, {5, 1}, {6, 1},
+                                  {5, 1}, {4, 1}, {3, 1}, {2, 1}, {1, 1},
+                                  {0, 1}, {1, 1}};
+  s21::CompactPath compact = s21::CompactPath::Encode(path);
+  ExpectSamePath(compact.Decode(), path);
+  std::vector<s21::CompactPath::Run> runs;
+  for (const auto& run : compact.GetRuns()) runs.push_back(run);
+  ASSERT_EQ(runs.size(), 6u);
+  EXPECT_EQ(runs[1].move, s21::CompactPath::Move::kLeft);
+  EXPECT_EQ(runs[1].length, 6u);
+  EXPECT_EQ(runs[4].length, 6u);
+  EXPECT_EQ(runs[5].move, s21::CompactPath::Move::kDown);
+  EXPECT_EQ(runs[5].to.row, 1);
+}
+
+TEST(CompactPath, BitsPerStep) {
+  for (auto kind : {s21::GeneratorKind::kEller, s21::GeneratorKind::kKruskal,
+                    s21::GeneratorKind::kWilson,
+                    s21::GeneratorKind::kBacktracker}) {
+    s21::Model model;
+    model.GenerateMaze(1000, 1000, kind);
+    //  волновой поиск модели на таком лабиринте долог, путь дает обход
+    //  в ширину
+    s21::DistanceField field;
+    field.Build(model.GetRightBorders(), model.GetBottomBorders(), {0, 0});
+    auto path = field.GetPath(model.GetRightBorders(),
+                              model.GetBottomBorders(), {999, 999});
+    ASSERT_GT(path.size(), 1998u);
+    s21::CompactPath compact = s21::CompactPath::Encode(path);
+    ExpectSamePath(compact.Decode(), path);
+    //  не больше 2 бит на ход, то есть в 32 раза меньше вектора точек
+    std::size_t moves = path.size() - 1;
+    EXPECT_LE(compact.Symbols(), moves);
+    EXPECT_LE(compact.Bytes(), (moves + 3) / 4);
+    EXPECT_GE(path.size() * sizeof(s21::Point), 30 * compact.Bytes());
+  }
+}
+
+TEST(CompactPath, Controller) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.GenerateMaze(50, 50);
+  auto path = controller.GetPath({0, 0}, {49, 49});
+  auto compact = controller.GetCompactPath({0, 0}, {49, 49});
+  ExpectSamePath(compact.Decode(), path);
+  EXPECT_LT(compact.Bytes(), path.size() * sizeof(s21::Point));
+}
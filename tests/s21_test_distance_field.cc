@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "../controller/s21_controller.h"
+
+namespace {
+
+//  сравнение поля после правок с полем, построенным заново
+void ExpectSameAsRebuilt(s21::Model* model) {
+  s21::DistanceField rebuilt;
+  rebuilt.Build(model->GetRightBorders(), model->GetBottomBorders(),
+                model->GetStartPoint());
+  const s21::DistanceField& field = model->GetDistanceField();
+  for (int i = 0; i < model->GetMazeRows(); i++) {
+    for (int j = 0; j < model->GetMazeCols(); j++) {
+      ASSERT_EQ(field.GetDistance({i, j}), rebuilt.GetDistance({i, j}))
+          << i << " " << j;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(DistanceField, SameAsWave) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  model.SetStartPoint({2, 0});
+  EXPECT_EQ(model.GetDistance({3, 3}), 10);
+  auto expected = model.GetPath({2, 0}, {3, 3});
+  model.ToggleRightWall(0, 0);
+  model.ToggleRightWall(0, 0);
+  auto path = model.GetPath({2, 0}, {3, 3});
+  ASSERT_EQ(path.size(), expected.size());
+  for (size_t i = 0; i < path.size(); i++) {
+    EXPECT_EQ(path[i].row, expected[i].row);
+    EXPECT_EQ(path[i].col, expected[i].col);
+  }
+}
+
+TEST(DistanceField, RandomToggles) {
+  s21::Model model;
+  model.GenerateMaze(40, 60);
+  model.SetStartPoint({20, 30});
+  std::mt19937 gen(12345);
+  for (int k = 0; k < 300; k++) {
+    int row = gen() % 40, col = gen() % 60;
+    if (gen() % 2) {
+      model.ToggleRightWall(row, col);
+    } else {
+      model.ToggleBottomWall(row, col);
+    }
+    ExpectSameAsRebuilt(&model);
+  }
+}
+
+TEST(DistanceField, LocalRepair) {
+  s21::Model model;
+  model.GenerateMaze(200, 200);
+  model.SetStartPoint({0, 0});
+  const auto& right = model.GetRightBorders();
+  const auto& bottom = model.GetBottomBorders();
+  //  закрытие единственного прохода из тупика затрагивает только сам тупик,
+  //  а не весь лабиринт
+  for (int i = 100; i < 199; i++) {
+    for (int j = 100; j < 199; j++) {
+      bool open_right = !right[i][j], open_left = !right[i][j - 1];
+      bool open_down = !bottom[i][j], open_up = !bottom[i - 1][j];
+      if (open_right + open_left + open_down + open_up != 1) continue;
+      auto toggle = [&]() {
+        if (open_right) model.ToggleRightWall(i, j);
+        if (open_left) model.ToggleRightWall(i, j - 1);
+        if (open_down) model.ToggleBottomWall(i, j);
+        if (open_up) model.ToggleBottomWall(i - 1, j);
+      };
+      toggle();
+      EXPECT_EQ(model.GetDistanceField().GetTouched(), 1u);
+      EXPECT_EQ(model.GetDistance({i, j}), s21::DistanceField::kUnreachable);
+      toggle();
+      EXPECT_EQ(model.GetDistanceField().GetTouched(), 1u);
+      ExpectSameAsRebuilt(&model);
+      return;
+    }
+  }
+  FAIL() << "Тупик не найден";
+}
+
+TEST(DistanceField, Disconnect) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  model.SetStartPoint({2, 0});
+  //  (2, 0) соединена с остальным лабиринтом только через (2, 1)
+  model.ToggleRightWall(2, 0);
+  EXPECT_EQ(model.GetDistance({3, 3}), s21::DistanceField::kUnreachable);
+  EXPECT_TRUE(model.GetPath({2, 0}, {3, 3}).empty());
+  model.ToggleRightWall(2, 0);
+  EXPECT_EQ(model.GetPath({2, 0}, {3, 3}).size(), 11u);
+  EXPECT_THROW(model.ToggleBottomWall(4, 0), std::invalid_argument);
+}
+
+TEST(DistanceField, Controller) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile("mazes/maze4.txt");
+  controller.SetStartPoint({2, 0});
+  controller.ToggleRightWall(2, 0);
+  EXPECT_TRUE(controller.GetPath({2, 0}, {3, 3}).empty());
+  controller.ToggleRightWall(2, 0);
+  EXPECT_EQ(controller.GetPath({2, 0}, {3, 3}).size(), 11u);
+}
+
+TEST(DistanceField, ControllerUsesFieldAfterEdits) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile("mazes/maze20.txt");
+  controller.SetStartPoint({0, 0});
+  controller.ToggleRightWall(5, 5);
+  controller.ToggleBottomWall(7, 3);
+  ASSERT_TRUE(model.HasDistanceField({0, 0}));
+  std::size_t touched = model.GetDistanceField().GetTouched();
+
+  //  путь из начальной точки берется из поля: быстрый лабиринт не
+  //  перезагружается, волна модели не запускается, а поле не перестраивается
+  const auto& right = model.GetRightBorders();
+  const auto& bottom = model.GetBottomBorders();
+  for (int i = 0; i < 20; i++) {
+    auto path = controller.GetPath({0, 0}, {19, i});
+    auto expected =
+        model.GetDistanceField().GetPath(right, bottom, {19, i});
+    ASSERT_EQ(path.size(), expected.size());
+    for (std::size_t k = 0; k < path.size(); k++) {
+      EXPECT_EQ(path[k].row, expected[k].row);
+      EXPECT_EQ(path[k].col, expected[k].col);
+    }
+  }
+  EXPECT_EQ(model.GetMemoryUsage(s21::ModelOperation::kSolve).allocations,
+            0u);
+  EXPECT_EQ(model.GetDistanceField().GetTouched(), touched);
+  EXPECT_TRUE(controller.IsFixedMazeStale());
+
+  //  запрос из другой точки перезагружает быстрый лабиринт и видит правки
+  s21::DistanceField other;
+  other.Build(right, bottom, {19, 19});
+  EXPECT_EQ(controller.GetPath({19, 19}, {0, 0}).size(),
+            other.GetPath(right, bottom, {0, 0}).size());
+  EXPECT_FALSE(controller.IsFixedMazeStale());
+}
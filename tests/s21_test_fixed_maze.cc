@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "../controller/s21_controller.h"
+#include "../model/s21_fixed_maze.h"
+
+namespace {
+
+template <std::size_t R, std::size_t C>
+constexpr std::size_t SolveGenerated(std::uint64_t seed) {
+  s21::FixedMaze<R, C> maze;
+  maze.Generate(seed);
+  std::array<std::uint16_t, R * C> path{};
+  return maze.Solve(0, R * C - 1, &path);
+}
+
+//  в идеальном лабиринте число проходов на единицу меньше числа клеток
+int CountPassages(const s21::WallMatrix& right, const s21::WallMatrix& bottom) {
+  int rows = right.size(), cols = right[0].size(), count = 0;
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      if (j < cols - 1 && !right[i][j]) count++;
+      if (i < rows - 1 && !bottom[i][j]) count++;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(FixedMaze, ConstexprGenerateAndSolve) {
+  constexpr std::size_t length = SolveGenerated<8, 8>(42);
+  static_assert(length >= 15, "Путь из угла в угол не короче 15 клеток");
+  EXPECT_EQ(length, (SolveGenerated<8, 8>(42)));
+}
+
+TEST(FixedMaze, GeneratePerfect) {
+  s21::FixedMaze<50, 50> maze(37, 23);
+  maze.Generate(7);
+  s21::WallMatrix right, bottom;
+  maze.Store(&right, &bottom);
+  EXPECT_EQ(CountPassages(right, bottom), 37 * 23 - 1);
+  for (int i = 0; i < 37; i++) EXPECT_EQ(right[i][22], 1);
+  EXPECT_FALSE(maze.GetPath({0, 0}, {36, 22}).empty());
+}
+
+TEST(FixedMaze, SameAsModel) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  auto fixed = s21::MakeFixedMaze(4, 4);
+  ASSERT_NE(fixed, nullptr);
+  fixed->Load(model.GetRightBorders(), model.GetBottomBorders());
+  auto expected = model.GetPath({2, 0}, {3, 3});
+  auto path = fixed->GetPath({2, 0}, {3, 3});
+  ASSERT_EQ(path.size(), expected.size());
+  for (size_t i = 0; i < path.size(); i++) {
+    EXPECT_EQ(path[i].row, expected[i].row);
+    EXPECT_EQ(path[i].col, expected[i].col);
+  }
+}
+
+TEST(FixedMaze, MakeFixedMazeLimits) {
+  EXPECT_NE(s21::MakeFixedMaze(1, 1), nullptr);
+  EXPECT_NE(s21::MakeFixedMaze(50, 50), nullptr);
+  EXPECT_EQ(s21::MakeFixedMaze(51, 10), nullptr);
+  EXPECT_EQ(s21::MakeFixedMaze(0, 10), nullptr);
+}
+
+TEST(FixedMaze, ControllerDispatch) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.GenerateMaze(15, 42);
+  EXPECT_EQ(controller.GetMazeRows(), 15);
+  EXPECT_EQ(controller.GetMazeCols(), 42);
+  EXPECT_EQ(CountPassages(controller.GetRightBorders(),
+                          controller.GetBottomBorders()),
+            15 * 42 - 1);
+  auto path = controller.GetPath({0, 0}, {14, 41});
+  auto expected = model.GetPath({0, 0}, {14, 41});
+  EXPECT_EQ(path.size(), expected.size());
+}
+
+TEST(FixedMaze, ControllerSeededGeneration) {
+  //  небольшой лабиринт тоже строит зерно генератора модели
+  s21::Model plain;
+  plain.SeedGenerator(s21::GeneratorKind::kEller, 123);
+  plain.GenerateMaze(12, 20);
+  for (int i = 0; i < 2; i++) {
+    s21::Model model;
+    s21::Controller controller(&model);
+    model.SeedGenerator(s21::GeneratorKind::kEller, 123);
+    controller.GenerateMaze(12, 20);
+    EXPECT_EQ(controller.GetRightBorders(), plain.GetRightBorders());
+    EXPECT_EQ(controller.GetBottomBorders(), plain.GetBottomBorders());
+    EXPECT_EQ(controller.GetPath({0, 0}, {11, 19}).size(),
+              plain.GetPath({0, 0}, {11, 19}).size());
+  }
+}
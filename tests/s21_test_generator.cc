@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "../controller/s21_controller.h"
+
+TEST(Generator, AllPerfect) {
+  s21::MazeValidator validator;
+  s21::WallMatrix right, bottom;
+  for (s21::GeneratorKind kind : s21::kGeneratorKinds) {
+    auto generator = s21::MakeGenerator(kind, 42);
+    for (auto [rows, cols] : {std::pair{1, 1}, std::pair{1, 7},
+                              std::pair{9, 1}, std::pair{23, 31}}) {
+      generator->Generate(rows, cols, &right, &bottom);
+      ASSERT_EQ(right.size(), static_cast<std::size_t>(rows));
+      ASSERT_EQ(bottom.size(), static_cast<std::size_t>(rows));
+      ASSERT_EQ(right[0].size(), static_cast<std::size_t>(cols));
+      auto result = validator.Validate(right, bottom);
+      EXPECT_EQ(result.kind, s21::MazeValidation::Kind::kPerfect)
+          << s21::GeneratorName(kind) << " " << rows << "x" << cols;
+      for (int i = 0; i < rows; i++) EXPECT_EQ(right[i][cols - 1], 1);
+    }
+  }
+}
+
+TEST(Generator, EllerWordBoundaries) {
+  s21::MazeValidator validator;
+  s21::WallMatrix right, bottom;
+  s21::EllerGenerator generator(11);
+  //  ширины вокруг границ 64-битных слов строки
+  for (int cols : {2, 63, 64, 65, 127, 128, 129, 300}) {
+    generator.Generate(40, cols, &right, &bottom);
+    EXPECT_EQ(validator.Validate(right, bottom).kind,
+              s21::MazeValidation::Kind::kPerfect)
+        << cols;
+    //  случайные слова действительно используются: стены есть и внутри
+    //  строки, а не только между множествами
+    int walls = 0;
+    for (const auto& row : right) {
+      for (int j = 0; j < cols - 1; j++) walls += row[j];
+    }
+    EXPECT_GT(walls, 0);
+    EXPECT_LT(walls, 40 * (cols - 1));
+  }
+}
+
+TEST(Generator, Seed) {
+  for (s21::GeneratorKind kind : s21::kGeneratorKinds) {
+    s21::WallMatrix right[2], bottom[2];
+    auto generator = s21::MakeGenerator(kind, 7);
+    generator->Generate(20, 20, &right[0], &bottom[0]);
+    generator->Seed(7);
+    generator->Generate(20, 20, &right[1], &bottom[1]);
+    EXPECT_EQ(right[0], right[1]);
+    EXPECT_EQ(bottom[0], bottom[1]);
+    generator->Generate(20, 20, &right[1], &bottom[1]);
+    EXPECT_TRUE(right[0] != right[1] || bottom[0] != bottom[1]);
+  }
+}
+
+TEST(Generator, Names) {
+  for (s21::GeneratorKind kind : s21::kGeneratorKinds) {
+    EXPECT_EQ(s21::GeneratorFromName(s21::GeneratorName(kind)), kind);
+  }
+  EXPECT_THROW(s21::GeneratorFromName("prim"), std::invalid_argument);
+}
+
+TEST(Generator, Stream) {
+  s21::SidewinderGenerator sidewinder(3);
+  s21::WallMatrix right, bottom;
+  sidewinder.Generate(12, 15, &right, &bottom);
+  sidewinder.Seed(3);
+  int next = 0;
+  sidewinder.Stream(12, 15,
+                    [&](int row, const s21::WallRow& right_row,
+                        const s21::WallRow& bottom_row) {
+                      EXPECT_EQ(row, next++);
+                      EXPECT_EQ(right_row, right[row]);
+                      EXPECT_EQ(bottom_row, bottom[row]);
+                    });
+  EXPECT_EQ(next, 12);
+}
+
+TEST(Generator, Controller) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  for (s21::GeneratorKind kind : s21::kGeneratorKinds) {
+    controller.ClearData();
+    controller.GenerateMaze(30, 40, kind);
+    EXPECT_EQ(controller.GetMazeRows(), 30);
+    EXPECT_EQ(controller.GetMazeCols(), 40);
+    EXPECT_EQ(controller.Validate().kind, s21::MazeValidation::Kind::kPerfect);
+    auto path = controller.GetPath({0, 0}, {29, 39});
+    EXPECT_EQ(path.size(), model.GetPath({0, 0}, {29, 39}).size());
+    EXPECT_FALSE(path.empty());
+  }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <set>
+#include <thread>
+
+#include "../controller/s21_controller.h"
+
+TEST(MazeArchive, AppendAndLoad) {
+  std::remove("archive_test.bin");
+  std::vector<s21::Model> mazes(3);
+  mazes[0].ReadFromFile("mazes/maze4.txt");
+  mazes[1].GenerateMaze(7, 130);
+  mazes[2].GenerateMaze(50, 1);
+  for (std::size_t i = 0; i < mazes.size(); i++) {
+    EXPECT_EQ(mazes[i].AppendToArchive("archive_test.bin"),
+              static_cast<long>(i));
+  }
+
+  s21::MazeArchive archive;
+  ASSERT_TRUE(archive.Open("archive_test.bin"));
+  ASSERT_EQ(archive.Size(), mazes.size());
+  EXPECT_EQ(archive.GetEntry(1).rows, 7u);
+  EXPECT_EQ(archive.GetEntry(1).cols, 130u);
+
+  //  в обратном порядке, чтобы чтение не зависело от предыдущих лабиринтов
+  for (std::size_t i = mazes.size(); i-- > 0;) {
+    s21::Model model;
+    model.ReadFromArchive(archive, i);
+    EXPECT_EQ(model.GetMazeRows(), mazes[i].GetMazeRows());
+    EXPECT_EQ(model.GetMazeCols(), mazes[i].GetMazeCols());
+    EXPECT_EQ(model.GetRightBorders(), mazes[i].GetRightBorders());
+    EXPECT_EQ(model.GetBottomBorders(), mazes[i].GetBottomBorders());
+  }
+  EXPECT_THROW(archive.GetEntry(3), std::out_of_range);
+  std::remove("archive_test.bin");
+}
+
+TEST(MazeArchive, OpenInvalid) {
+  s21::MazeArchive archive;
+  EXPECT_FALSE(archive.Open("mazes/aboba.bin"));
+  EXPECT_FALSE(archive.Open("mazes/maze4.txt"));
+  EXPECT_EQ(archive.Size(), 0u);
+  EXPECT_EQ(s21::MazeArchive::Append("mazes/maze4.txt", {{1}}, {{1}}), -1);
+}
+
+TEST(MazeArchive, CorruptedHeader) {
+  std::remove("archive_test.bin");
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  ASSERT_EQ(model.AppendToArchive("archive_test.bin"), 0);
+  //  смещение индекса и число записей подобраны так, что их сумма
+  //  переполняется и указывает внутрь файла
+  std::uint32_t count = 1u << 28;
+  std::uint64_t offset = 0 - (std::uint64_t{1} << 32) + 24;
+  std::FILE* file = std::fopen("archive_test.bin", "r+b");
+  ASSERT_NE(file, nullptr);
+  std::fseek(file, 12, SEEK_SET);
+  std::fwrite(&count, sizeof(count), 1, file);
+  std::fwrite(&offset, sizeof(offset), 1, file);
+  std::fwrite(&count, sizeof(count), 1, file);
+  std::fclose(file);
+
+  s21::MazeArchive archive;
+  EXPECT_FALSE(archive.Open("archive_test.bin"));
+  EXPECT_EQ(model.AppendToArchive("archive_test.bin"), -1);
+  std::remove("archive_test.bin");
+}
+
+TEST(MazeArchive, InterruptedAppend) {
+  std::remove("archive_test.bin");
+  s21::Model model;
+  model.GenerateMaze(5, 5);
+  ASSERT_EQ(model.AppendToArchive("archive_test.bin"), 0);
+  //  недописанные данные прерванной записи в конце файла
+  std::FILE* file = std::fopen("archive_test.bin", "ab");
+  ASSERT_NE(file, nullptr);
+  std::fputs("garbage", file);
+  std::fclose(file);
+
+  s21::MazeArchive archive;
+  ASSERT_TRUE(archive.Open("archive_test.bin"));
+  EXPECT_EQ(archive.Size(), 1u);
+  model.GenerateMaze(6, 70);
+  EXPECT_EQ(model.AppendToArchive("archive_test.bin"), 1);
+  ASSERT_TRUE(archive.Open("archive_test.bin"));
+  ASSERT_EQ(archive.Size(), 2u);
+  s21::Model loaded;
+  loaded.ReadFromArchive(archive, 1);
+  EXPECT_EQ(loaded.GetRightBorders(), model.GetRightBorders());
+  EXPECT_EQ(loaded.GetBottomBorders(), model.GetBottomBorders());
+  std::remove("archive_test.bin");
+}
+
+TEST(MazeArchive, ConcurrentAppends) {
+  std::remove("archive_test.bin");
+  //  больше записей, чем начальная емкость индекса
+  constexpr int kThreads = 4, kMazes = 10;
+  std::vector<std::vector<long>> ids(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([t, &ids] {
+      s21::WallMatrix right(3, s21::WallRow(t + 2, 1));
+      for (int i = 0; i < kMazes; i++) {
+        ids[t].push_back(
+            s21::MazeArchive::Append("archive_test.bin", right, right));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  std::set<long> unique;
+  for (const auto& list : ids) unique.insert(list.begin(), list.end());
+  EXPECT_EQ(unique.size(), static_cast<std::size_t>(kThreads * kMazes));
+  EXPECT_EQ(*unique.begin(), 0);
+  s21::MazeArchive archive;
+  ASSERT_TRUE(archive.Open("archive_test.bin"));
+  ASSERT_EQ(archive.Size(), static_cast<std::size_t>(kThreads * kMazes));
+  for (int t = 0; t < kThreads; t++) {
+    for (long id : ids[t]) {
+      EXPECT_EQ(archive.GetEntry(id).cols, static_cast<std::uint32_t>(t + 2));
+      s21::WallMatrix right, bottom;
+      archive.Load(id, &right, &bottom);
+      EXPECT_EQ(right, s21::WallMatrix(3, s21::WallRow(t + 2, 1)));
+    }
+  }
+  std::remove("archive_test.bin");
+}
+
+TEST(MazeArchive, Controller) {
+  std::remove("archive_test.bin");
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile("mazes/maze4.txt");
+  EXPECT_EQ(controller.AppendToArchive("archive_test.bin"), 0);
+  controller.GenerateMaze(10, 10);
+  EXPECT_EQ(controller.AppendToArchive("archive_test.bin"), 1);
+  controller.ReadFromArchive("archive_test.bin", 0);
+  EXPECT_EQ(controller.GetMazeRows(), 4);
+  EXPECT_EQ(controller.GetPath({2, 0}, {3, 3}).size(), 11u);
+  ASSERT_EXIT(controller.ReadFromArchive("archive_test.bin", 2),
+              ::testing::ExitedWithCode(1), "");
+  std::remove("archive_test.bin");
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+
+#include "../model/s21_model.h"
+
+TEST(MazeIo, CompressionFromName) {
+  EXPECT_EQ(s21::CompressionFromName("maze.txt"), s21::Compression::kNone);
+  EXPECT_EQ(s21::CompressionFromName("maze.txt.gz"), s21::Compression::kGzip);
+  EXPECT_EQ(s21::CompressionFromName("maze.zst"), s21::Compression::kZstd);
+}
+
+TEST(MazeIo, SaveAndReadPlain) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  ASSERT_TRUE(model.SaveToFile("maze_io_test.txt"));
+  s21::Model loaded;
+  loaded.ReadFromFile("maze_io_test.txt");
+  EXPECT_EQ(loaded.GetRightBorders(), model.GetRightBorders());
+  EXPECT_EQ(loaded.GetBottomBorders(), model.GetBottomBorders());
+  std::remove("maze_io_test.txt");
+}
+
+TEST(MazeIo, SaveAndReadGzip) {
+  s21::Model model;
+  model.GenerateMaze(300, 250);
+  ASSERT_TRUE(model.SaveToFile("maze_io_test.txt.gz", s21::Compression::kGzip));
+
+  std::FILE* file = std::fopen("maze_io_test.txt.gz", "rb");
+  ASSERT_NE(file, nullptr);
+  unsigned char magic[2] = {0, 0};
+  EXPECT_EQ(std::fread(magic, 1, 2, file), 2u);
+  std::fseek(file, 0, SEEK_END);
+  long compressed = std::ftell(file);
+  std::fclose(file);
+  EXPECT_EQ(magic[0], 0x1F);
+  EXPECT_EQ(magic[1], 0x8B);
+  EXPECT_LT(compressed, 300 * 250 * 4 / 10);
+
+  s21::Model loaded;
+  loaded.ReadFromFile("maze_io_test.txt.gz");
+  EXPECT_EQ(loaded.GetMazeRows(), 300);
+  EXPECT_EQ(loaded.GetMazeCols(), 250);
+  EXPECT_EQ(loaded.GetRightBorders(), model.GetRightBorders());
+  EXPECT_EQ(loaded.GetBottomBorders(), model.GetBottomBorders());
+  std::remove("maze_io_test.txt.gz");
+}
+
+TEST(MazeIo, ReadTruncatedGzip) {
+  s21::Model model;
+  model.GenerateMaze(50, 50);
+  ASSERT_TRUE(model.SaveToFile("maze_io_test.txt.gz", s21::Compression::kGzip));
+  std::FILE* file = std::fopen("maze_io_test.txt.gz", "r+b");
+  ASSERT_NE(file, nullptr);
+  std::fseek(file, 0, SEEK_END);
+  long size = std::ftell(file);
+  std::fclose(file);
+  ASSERT_EQ(truncate("maze_io_test.txt.gz", size / 2), 0);
+  ASSERT_EXIT(model.ReadFromFile("maze_io_test.txt.gz"),
+              ::testing::ExitedWithCode(1), "");
+  std::remove("maze_io_test.txt.gz");
+}
+
+#ifndef S21_WITH_ZSTD
+TEST(MazeIo, ZstdDisabled) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  EXPECT_FALSE(model.SaveToFile("maze_io_test.zst", s21::Compression::kZstd));
+}
+#endif
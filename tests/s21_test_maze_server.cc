@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "../model/s21_maze_server.h"
+
+TEST(MazeServer, Protocol) {
+  s21::MazeServer server;
+  EXPECT_EQ(server.Handle("load m mazes/maze20.txt"), "ok 20 20");
+  s21::Model model;
+  model.ReadFromFile("mazes/maze20.txt");
+  auto expected = model.GetPath({0, 0}, {19, 19});
+  std::istringstream response(server.Handle("solve m 0 0 19 19"));
+  std::string ok;
+  std::size_t length;
+  response >> ok >> length;
+  EXPECT_EQ(ok, "ok");
+  ASSERT_EQ(length, expected.size());
+  for (const s21::Point& point : expected) {
+    int row, col;
+    response >> row >> col;
+    EXPECT_EQ(row, point.row);
+    EXPECT_EQ(col, point.col);
+  }
+
+  s21::MazeStats stats = s21::MazeAnalyzer().Analyze(
+      model.GetRightBorders(), model.GetBottomBorders());
+  std::ostringstream line;
+  line << "ok 20 20 " << stats.diameter << ' ' << stats.dead_ends << ' '
+       << stats.corridors << ' ' << stats.junctions << ' ' << stats.isolated;
+  EXPECT_EQ(server.Handle("stats m"), line.str());
+  EXPECT_EQ(server.Handle("generate g 5 7 kruskal"), "ok 5 7");
+  EXPECT_EQ(server.Handle("stats"), "ok 2 5");
+  EXPECT_EQ(server.Handle("drop g"), "ok");
+  EXPECT_EQ(server.GetMazeCount(), 1u);
+}
+
+TEST(MazeServer, Errors) {
+  s21::MazeServer server;
+  auto failed = [&server](const std::string& request) {
+    return server.Handle(request).rfind("error ", 0) == 0;
+  };
+  EXPECT_TRUE(failed("load m mazes/missing.txt"));
+  EXPECT_TRUE(failed("solve m 0 0 1 1"));
+  EXPECT_TRUE(failed("generate m 0 5"));
+  EXPECT_TRUE(failed("generate m 5 x"));
+  EXPECT_TRUE(failed("generate m 5 5 unknown"));
+  EXPECT_EQ(server.Handle("generate m 5 5"), "ok 5 5");
+  EXPECT_TRUE(failed("solve m 0 0 5 5"));
+  EXPECT_TRUE(failed("solve m 0 0"));
+  EXPECT_TRUE(failed("drop other"));
+  EXPECT_TRUE(failed("fly m"));
+  EXPECT_EQ(server.GetMazeCount(), 1u);
+}
+
+TEST(MazeServer, SizeLimit) {
+  s21::MazeServer server;
+  const std::string bad_args = "error Неверные аргументы.";
+  EXPECT_EQ(server.Handle("generate m 4097 4096"), bad_args);
+  EXPECT_EQ(server.Handle("generate m 70000 70000"), bad_args);
+  {
+    //  заголовок обещает 10^10 клеток, матрицы не должны выделяться
+    std::ofstream file("huge_maze.txt");
+    file << "100000 100000\n0 1\n";
+  }
+  EXPECT_EQ(server.Handle("load m huge_maze.txt"),
+            "error Слишком большой лабиринт.");
+  std::remove("huge_maze.txt");
+  EXPECT_EQ(server.GetMazeCount(), 0u);
+}
+
+TEST(MazeServer, SharedReads) {
+  s21::MazeServer server;
+  server.Handle("generate m 60 60");
+  std::vector<std::thread> readers;
+  std::atomic<int> solved{0};
+  for (int i = 0; i < 4; i++) {
+    readers.emplace_back([&server, &solved, i] {
+      for (int j = 0; j < 20; j++) {
+        std::string response =
+            server.Handle("solve m 0 " + std::to_string(i) + " 59 59");
+        if (response.rfind("ok ", 0) == 0 && response != "ok 0") solved++;
+      }
+    });
+  }
+  //  замена лабиринта во время чтения: читатели дорабатывают со старым
+  for (int j = 0; j < 5; j++) server.Handle("generate m 60 60");
+  for (auto& reader : readers) reader.join();
+  EXPECT_EQ(solved, 80);
+}
+
+TEST(MazeServer, Socket) {
+  std::string path = "s21_test_maze_server.sock";
+  s21::MazeServer server(2);
+  bool served = false;
+  std::thread thread(
+      [&server, &served, &path] { served = server.Serve(path); });
+  std::string response;
+  //  сервер мог еще не открыть сокет
+  for (int i = 0; i < 200; i++) {
+    if (s21::MazeServer::Request(path, "stats", &response)) break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(response.rfind("ok 0 ", 0), 0u);
+  ASSERT_TRUE(s21::MazeServer::Request(path, "generate a 10 10", &response));
+  EXPECT_EQ(response, "ok 10 10");
+  ASSERT_TRUE(s21::MazeServer::Request(path, "solve a 0 0 9 9", &response));
+  EXPECT_EQ(response.rfind("ok ", 0), 0u);
+  server.Stop();
+  thread.join();
+  EXPECT_TRUE(served);
+  EXPECT_FALSE(s21::MazeServer::Request(path, "stats", &response));
+}
+
+TEST(MazeServer, IdleClientsDoNotBlock) {
+  std::string path = "s21_test_idle_server.sock";
+  s21::MazeServer server(2);
+  std::thread thread([&server, &path] { server.Serve(path); });
+  std::string response;
+  for (int i = 0; i < 200; i++) {
+    if (s21::MazeServer::Request(path, "stats", &response)) break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  //  молчащих клиентов больше, чем потоков пула
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  std::strcpy(address.sun_path, path.c_str());
+  std::vector<int> idle;
+  for (int i = 0; i < 6; i++) {
+    int client = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(connect(client, reinterpret_cast<sockaddr*>(&address),
+                      sizeof(address)),
+              0);
+    idle.push_back(client);
+  }
+  //  клиент с незаконченной строкой тоже не держит поток
+  ASSERT_EQ(write(idle[0], "stats", 5), 5);
+  ASSERT_TRUE(s21::MazeServer::Request(path, "generate a 5 5", &response));
+  EXPECT_EQ(response, "ok 5 5");
+  //  несколько запросов в одной посылке выполняются по порядку
+  ASSERT_EQ(write(idle[1], "drop a\nstats\n", 13), 13);
+  char reply[64] = {};
+  std::string replies;
+  while (std::count(replies.begin(), replies.end(), '\n') < 2) {
+    ssize_t count = read(idle[1], reply, sizeof(reply));
+    ASSERT_GT(count, 0);
+    replies.append(reply, count);
+  }
+  EXPECT_EQ(replies.rfind("ok\nok 0 ", 0), 0u);
+  server.Stop();
+  thread.join();
+  for (int client : idle) close(client);
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "../controller/s21_controller.h"
+
+TEST(MazeStats, DiameterSameAsAllPairs) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.GenerateMaze(12, 9);
+  int diameter = 0;
+  for (int a = 0; a < 12 * 9; a++) {
+    for (int b = a + 1; b < 12 * 9; b++) {
+      int length = model.GetPath({a / 9, a % 9}, {b / 9, b % 9}).size() - 1;
+      diameter = std::max(diameter, length);
+    }
+  }
+  s21::MazeStats stats = controller.GetStats();
+  EXPECT_EQ(stats.diameter, diameter);
+  EXPECT_EQ(model.GetPath(stats.diameter_start, stats.diameter_end).size() - 1,
+            static_cast<std::size_t>(diameter));
+  EXPECT_EQ(stats.dead_ends + stats.corridors + stats.junctions, 12 * 9);
+  EXPECT_EQ(stats.isolated, 0);
+}
+
+TEST(MazeStats, Degrees) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile("mazes/maze4.txt");
+  s21::MazeStats stats = controller.GetStats();
+  EXPECT_EQ(stats.dead_ends, 5);
+  EXPECT_EQ(stats.corridors, 8);
+  EXPECT_EQ(stats.junctions, 3);
+  EXPECT_EQ(stats.diameter, 12);
+}
+
+TEST(MazeStats, Distances) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile("mazes/maze4disconnected.txt");
+  model.SetStartPoint({0, 0});
+  s21::DistanceStats stats = controller.GetDistanceStats({0, 0});
+  int reachable = 0, max_distance = 0;
+  double total = 0;
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      int d = model.GetDistance({i, j});
+      if (d == s21::DistanceField::kUnreachable) continue;
+      reachable++;
+      total += d;
+      max_distance = std::max(max_distance, d);
+    }
+  }
+  EXPECT_EQ(stats.reachable, reachable);
+  EXPECT_LT(stats.reachable, 16);
+  EXPECT_EQ(stats.max_distance, max_distance);
+  EXPECT_DOUBLE_EQ(stats.average_distance, total / reachable);
+  EXPECT_EQ(controller.GetDistanceStats({7, 0}).reachable, 0);
+}
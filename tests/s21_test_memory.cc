@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include "../model/s21_model.h"
+
+TEST(Memory, CountingResource) {
+  s21::CountingResource counter;
+  {
+    std::pmr::vector<int> values(&counter);
+    values.reserve(100);
+    EXPECT_EQ(counter.GetUsage().allocations, 1u);
+    EXPECT_EQ(counter.GetUsage().bytes, 100 * sizeof(int));
+    values.reserve(200);
+    EXPECT_EQ(counter.GetUsage().allocations, 2u);
+    EXPECT_EQ(counter.GetUsage().bytes, 200 * sizeof(int));
+    EXPECT_EQ(counter.GetUsage().peak, 300 * sizeof(int));
+  }
+  EXPECT_EQ(counter.GetUsage().bytes, 0u);
+  counter.Reset();
+  EXPECT_EQ(counter.GetUsage().allocations, 0u);
+  EXPECT_EQ(counter.GetUsage().peak, 0u);
+}
+
+TEST(Memory, ModelArena) {
+  s21::CountingResource upstream;
+  {
+    std::pmr::monotonic_buffer_resource arena(&upstream);
+    s21::Model model(&arena);
+    model.GenerateMaze(40, 60, s21::GeneratorKind::kKruskal);
+    //  строки матриц берут память у той же арены
+    const auto& right = model.GetRightBorders();
+    EXPECT_EQ(right.get_allocator().resource(), model.GetMemoryResource());
+    EXPECT_EQ(right[39].get_allocator().resource(), model.GetMemoryResource());
+    const s21::MemoryUsage& generate =
+        model.GetMemoryUsage(s21::ModelOperation::kGenerate);
+    EXPECT_GE(generate.peak, 2 * 40 * 60 * sizeof(int));
+    EXPECT_EQ(generate.bytes, model.GetMemoryUsage().bytes);
+
+    model.GetPath({0, 0}, {39, 59});
+    const s21::MemoryUsage& solve =
+        model.GetMemoryUsage(s21::ModelOperation::kSolve);
+    EXPECT_GT(solve.allocations, 0u);
+    EXPECT_GE(solve.peak, 3 * 40 * 60 * sizeof(int));
+    //  повторный поиск переиспользует волновую матрицу
+    model.GetPath({39, 0}, {0, 59});
+    EXPECT_EQ(solve.allocations, 0u);
+
+    //  файл читается в запасные матрицы, после обмена в них остается
+    //  прежний лабиринт, и повторное чтение переиспользует его память
+    model.ReadFromFile("mazes/maze4.txt");
+    model.ReadFromFile("mazes/maze4.txt");
+    const s21::MemoryUsage& load =
+        model.GetMemoryUsage(s21::ModelOperation::kLoad);
+    //  матрицы и компоненты укладываются в память прежних
+    EXPECT_EQ(load.allocations, 0u);
+    EXPECT_EQ(model.GetMazeRows(), 4);
+    EXPECT_GT(upstream.GetUsage().bytes, 0u);
+  }
+  //  арена отдает всю память лабиринта разом
+  EXPECT_EQ(upstream.GetUsage().bytes, 0u);
+}
+
+TEST(Memory, SetBordersCopiesIntoModel) {
+  s21::CountingResource counter;
+  {
+    s21::Model model(&counter);
+    s21::WallMatrix right = {{0, 1}, {0, 1}};
+    s21::WallMatrix bottom = {{0, 0}, {1, 1}};
+    model.SetBorders(right, bottom);
+    EXPECT_EQ(model.GetBottomBorders()[0].get_allocator().resource(),
+              model.GetMemoryResource());
+    EXPECT_EQ(model.GetMemoryUsage(s21::ModelOperation::kLoad).allocations,
+              6u);
+    EXPECT_EQ(counter.GetUsage().allocations, 6u);
+  }
+  EXPECT_EQ(counter.GetUsage().bytes, 0u);
+}
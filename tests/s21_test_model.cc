@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 
 #include "../model/s21_model.h"
@@ -80,13 +82,13 @@ TEST(Test, ReadFromFile) {
   model->ReadFromFile(filename);
   EXPECT_EQ(model->GetMazeRows(), 4);
   EXPECT_EQ(model->GetMazeCols(), 4);
-  std::vector<std::vector<int>> r_borders = {
+  s21::WallMatrix r_borders = {
       {0, 0, 0, 1},
       {1, 0, 1, 1},
       {0, 1, 0, 1},
       {0, 0, 0, 1},
   };
-  std::vector<std::vector<int>> b_borders = {
+  s21::WallMatrix b_borders = {
       {1, 0, 1, 0},
       {0, 0, 1, 0},
       {1, 1, 0, 1},
@@ -120,6 +122,31 @@ TEST(Test, ReadFromFileThrowEmpty) {
   delete model;
 }
 
+TEST(Test, TryReadFromFileKeepsMaze) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  s21::WallMatrix right = model.GetRightBorders();
+  std::uint64_t hash = model.GetHash();
+  {
+    //  стены верны, но стоимость клетки отрицательна
+    std::ofstream file("bad_costs.txt");
+    file << "2 2\n0 1\n0 1\n0 0\n1 1\n1 1\n1 -5\n";
+  }
+  for (const char* name : {"mazes/aboba.txt", "mazes/negative.txt",
+                           "mazes/empty_row_col.txt", "bad_costs.txt"}) {
+    std::string error;
+    EXPECT_FALSE(model.TryReadFromFile(name, &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_EQ(model.GetMazeRows(), 4);
+    EXPECT_EQ(model.GetMazeCols(), 4);
+    EXPECT_EQ(model.GetRightBorders(), right);
+    EXPECT_FALSE(model.HasCosts());
+    EXPECT_EQ(model.GetHash(), hash);
+    EXPECT_EQ(model.GetPath({2, 0}, {3, 3}).size(), 11u);
+  }
+  std::remove("bad_costs.txt");
+}
+
 TEST(Test, ClearData) {
   s21::Model* model = new s21::Model();
   model->ClearData();
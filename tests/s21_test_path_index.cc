@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+#include "../controller/s21_controller.h"
+
+namespace {
+
+//  проверка, что соседние точки пути смежны и между ними нет стены
+bool IsWalkable(s21::Model& model, const std::vector<s21::Point>& path) {
+  const auto& right = model.GetRightBorders();
+  const auto& bottom = model.GetBottomBorders();
+  for (std::size_t i = 1; i < path.size(); i++) {
+    const s21::Point& a = path[i - 1];
+    const s21::Point& b = path[i];
+    if (std::abs(a.row - b.row) + std::abs(a.col - b.col) != 1) return false;
+    bool wall = a.row == b.row ? right[a.row][std::min(a.col, b.col)]
+                               : bottom[std::min(a.row, b.row)][a.col];
+    if (wall) return false;
+  }
+  return true;
+}
+
+//  лабиринт с циклами: из идеального лабиринта убирается часть стен
+void MakeLooped(s21::Model* model, int rows, int cols, unsigned seed) {
+  model->GenerateMaze(rows, cols);
+  auto right = model->GetRightBorders();
+  auto bottom = model->GetBottomBorders();
+  std::mt19937 gen(seed);
+  for (int i = 0; i < rows * cols / 6; i++) {
+    int row = gen() % rows, col = gen() % cols;
+    if (gen() % 2 && col < cols - 1) {
+      right[row][col] = 0;
+    } else if (row < rows - 1) {
+      bottom[row][col] = 0;
+    }
+  }
+  model->SetBorders(std::move(right), std::move(bottom));
+}
+
+void ExpectShortest(s21::Model* model, const s21::PathIndex& index,
+                    int queries, unsigned seed) {
+  int rows = model->GetMazeRows(), cols = model->GetMazeCols();
+  std::mt19937 gen(seed);
+  for (int i = 0; i < queries; i++) {
+    s21::Point start(gen() % rows, gen() % cols);
+    s21::Point end(gen() % rows, gen() % cols);
+    auto path = index.GetPath(model->GetRightBorders(),
+                              model->GetBottomBorders(), start, end);
+    auto expected = model->GetPath(start, end);
+    ASSERT_EQ(path.size(), expected.size());
+    if (path.empty()) continue;
+    EXPECT_EQ(path.front().row, end.row);
+    EXPECT_EQ(path.front().col, end.col);
+    EXPECT_EQ(path.back().row, start.row);
+    EXPECT_EQ(path.back().col, start.col);
+    EXPECT_TRUE(IsWalkable(*model, path));
+  }
+}
+
+}  // namespace
+
+TEST(PathIndex, PerfectMaze) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  s21::PathIndex index;
+  index.Build(model.GetRightBorders(), model.GetBottomBorders(), 2, 2);
+  EXPECT_TRUE(index.IsValid());
+  EXPECT_GT(index.GetNodeCount(), 0u);
+  for (int i = 0; i < 16; i++) {
+    for (int j = 0; j < 16; j++) {
+      s21::Point start(i / 4, i % 4), end(j / 4, j % 4);
+      auto path = index.GetPath(model.GetRightBorders(),
+                                model.GetBottomBorders(), start, end);
+      EXPECT_EQ(path.size(), model.GetPath(start, end).size());
+      EXPECT_TRUE(IsWalkable(model, path));
+    }
+  }
+}
+
+TEST(PathIndex, LoopedMaze) {
+  s21::Model model;
+  MakeLooped(&model, 60, 70, 3);
+  s21::PathIndex index;
+  index.Build(model.GetRightBorders(), model.GetBottomBorders(), 8);
+  ExpectShortest(&model, index, 100, 5);
+  //  размер кластера не делит размеры лабиринта
+  index.Build(model.GetRightBorders(), model.GetBottomBorders(), 7, 3);
+  ExpectShortest(&model, index, 100, 6);
+}
+
+TEST(PathIndex, Unreachable) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4disconnected.txt");
+  s21::PathIndex index;
+  index.Build(model.GetRightBorders(), model.GetBottomBorders(), 2);
+  EXPECT_TRUE(index
+                  .GetPath(model.GetRightBorders(), model.GetBottomBorders(),
+                           {0, 0}, {2, 2})
+                  .empty());
+  EXPECT_EQ(index
+                .GetPath(model.GetRightBorders(), model.GetBottomBorders(),
+                         {1, 1}, {1, 1})
+                .size(),
+            1u);
+  EXPECT_THROW(
+      index.Build(model.GetRightBorders(), model.GetBottomBorders(), 1),
+      std::invalid_argument);
+}
+
+TEST(PathIndex, SaveLoad) {
+  s21::Model model;
+  MakeLooped(&model, 55, 40, 9);
+  s21::PathIndex index;
+  index.Build(model.GetRightBorders(), model.GetBottomBorders(), 10);
+  const std::string filename = "tests/path_index_test.hpa";
+  ASSERT_TRUE(index.Save(filename));
+
+  s21::PathIndex loaded;
+  ASSERT_TRUE(loaded.Load(filename, model.GetRightBorders(),
+                          model.GetBottomBorders()));
+  EXPECT_EQ(loaded.GetClusterSize(), 10);
+  EXPECT_EQ(loaded.GetNodeCount(), index.GetNodeCount());
+  EXPECT_EQ(loaded.GetEdgeCount(), index.GetEdgeCount());
+  ExpectShortest(&model, loaded, 50, 11);
+
+  //  индекс другого лабиринта не принимается
+  model.ToggleRightWall(10, 10);
+  EXPECT_FALSE(loaded.Load(filename, model.GetRightBorders(),
+                           model.GetBottomBorders()));
+  EXPECT_FALSE(loaded.IsValid());
+  std::remove(filename.c_str());
+  EXPECT_FALSE(loaded.Load(filename, model.GetRightBorders(),
+                           model.GetBottomBorders()));
+}
+
+TEST(PathIndex, DamagedArrays) {
+  s21::Model model;
+  MakeLooped(&model, 55, 40, 9);
+  s21::PathIndex index;
+  index.Build(model.GetRightBorders(), model.GetBottomBorders(), 10);
+  const std::string filename = "tests/path_index_test.hpa";
+  ASSERT_TRUE(index.Save(filename));
+  std::ifstream input(filename, std::ios::binary);
+  const std::vector<char> saved((std::istreambuf_iterator<char>(input)),
+                                std::istreambuf_iterator<char>());
+  input.close();
+
+  //  заголовок 48 байт, затем 6 * 4 + 1 смещений кластеров, вершины,
+  //  смещения ребер и ребра
+  std::size_t nodes = index.GetNodeCount();
+  ASSERT_GE(nodes, 2u);
+  std::size_t cluster_offsets = 48, nodes_at = cluster_offsets + 25 * 4;
+  std::size_t edge_offsets = nodes_at + nodes * 4;
+  std::size_t edges = edge_offsets + (nodes + 1) * 8;
+  ASSERT_EQ(saved.size(), edges + index.GetEdgeCount() * 8);
+  auto damaged = [&](std::size_t at, auto value) {
+    std::vector<char> bytes = saved;
+    std::memcpy(bytes.data() + at, &value, sizeof(value));
+    std::ofstream(filename, std::ios::binary)
+        .write(bytes.data(), bytes.size());
+    s21::PathIndex loaded;
+    bool ok = loaded.Load(filename, model.GetRightBorders(),
+                          model.GetBottomBorders());
+    return ok || loaded.IsValid();
+  };
+  EXPECT_FALSE(damaged(cluster_offsets + 4, std::uint32_t{0xFFFFFFFF}));
+  EXPECT_FALSE(damaged(nodes_at, std::int32_t{55 * 40}));
+  EXPECT_FALSE(damaged(nodes_at, std::int32_t{-1}));
+  //  вершина из чужого кластера
+  EXPECT_FALSE(damaged(nodes_at, std::int32_t{55 * 40 - 1}));
+  EXPECT_FALSE(damaged(edge_offsets + 8, std::uint64_t{1} << 40));
+  EXPECT_FALSE(damaged(edges, static_cast<std::int32_t>(nodes)));
+  EXPECT_FALSE(damaged(edges + 4, std::int32_t{-5}));
+  EXPECT_TRUE(damaged(0, saved[0]));
+  //  заголовок: сторона кластера, число вершин и число ребер
+  EXPECT_FALSE(damaged(20, std::int32_t{0x7FFFFFFF}));
+  EXPECT_FALSE(damaged(20, std::int32_t{56}));
+  EXPECT_FALSE(damaged(32, ~std::uint64_t{0}));
+  EXPECT_FALSE(damaged(40, ~std::uint64_t{0}));
+  std::remove(filename.c_str());
+}
+
+TEST(PathIndex, ClusterLargerThanMaze) {
+  s21::Model model;
+  MakeLooped(&model, 55, 40, 9);
+  s21::PathIndex index;
+  index.Build(model.GetRightBorders(), model.GetBottomBorders(), 1000);
+  EXPECT_EQ(index.GetClusterSize(), 55);
+  const std::string filename = "tests/path_index_test.hpa";
+  ASSERT_TRUE(index.Save(filename));
+  s21::PathIndex loaded;
+  ASSERT_TRUE(loaded.Load(filename, model.GetRightBorders(),
+                          model.GetBottomBorders()));
+  ExpectShortest(&model, loaded, 20, 5);
+  std::remove(filename.c_str());
+}
+
+TEST(PathIndex, Controller) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.GenerateMaze(80, 90);
+  controller.BuildPathIndex(12);
+  EXPECT_TRUE(controller.HasPathIndex());
+  s21::Point start(0, 0), end(79, 89);
+  auto path = controller.GetPath(start, end);
+  EXPECT_EQ(path.size(), model.GetPath(start, end).size());
+  EXPECT_TRUE(IsWalkable(model, path));
+  controller.ToggleBottomWall(5, 5);
+  EXPECT_FALSE(controller.HasPathIndex());
+}
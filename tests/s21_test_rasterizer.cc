@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "../controller/s21_controller.h"
+
+namespace {
+
+std::string ReadAll(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), {});
+}
+
+std::uint32_t GetU32(const std::string& data, std::size_t pos) {
+  return static_cast<std::uint32_t>(static_cast<unsigned char>(data[pos]))
+             << 24 |
+         static_cast<unsigned char>(data[pos + 1]) << 16 |
+         static_cast<unsigned char>(data[pos + 2]) << 8 |
+         static_cast<unsigned char>(data[pos + 3]);
+}
+
+//  разбор PNG: проверка CRC блоков и распаковка IDAT в номера цветов
+std::vector<std::string> DecodePng(const std::string& data, int* width,
+                                   int* height) {
+  std::string compressed;
+  for (std::size_t pos = 8; pos < data.size();) {
+    std::uint32_t length = GetU32(data, pos);
+    std::string type = data.substr(pos + 4, 4);
+    const auto* bytes =
+        reinterpret_cast<const unsigned char*>(data.data() + pos + 4);
+    EXPECT_EQ(crc32(0, bytes, length + 4), GetU32(data, pos + 8 + length));
+    if (type == "IHDR") {
+      *width = GetU32(data, pos + 8);
+      *height = GetU32(data, pos + 12);
+    } else if (type == "IDAT") {
+      compressed += data.substr(pos + 8, length);
+    }
+    pos += length + 12;
+  }
+  std::vector<unsigned char> raw(static_cast<std::size_t>(*height) *
+                                 (*width + 1));
+  uLongf size = raw.size();
+  EXPECT_EQ(uncompress(raw.data(), &size,
+                       reinterpret_cast<const Bytef*>(compressed.data()),
+                       compressed.size()),
+            Z_OK);
+  EXPECT_EQ(size, raw.size());
+  std::vector<std::string> rows;
+  for (int y = 0; y < *height; y++) {
+    const char* row =
+        reinterpret_cast<const char*>(raw.data()) + y * (*width + 1);
+    EXPECT_EQ(row[0], 0);
+    rows.emplace_back(row + 1, *width);
+  }
+  return rows;
+}
+
+}  // namespace
+
+TEST(Rasterizer, Pbm) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  s21::MazeRasterizer rasterizer(2);
+  rasterizer.SetCellSize(4);
+  const std::string filename = "tests/raster_test.pbm";
+  ASSERT_EQ(s21::MazeRasterizer::FormatFromName(filename),
+            s21::RasterFormat::kPbm);
+  ASSERT_TRUE(rasterizer.Write(filename, model.GetRightBorders(),
+                               model.GetBottomBorders(),
+                               s21::RasterFormat::kPbm));
+  std::string data = ReadAll(filename);
+  std::remove(filename.c_str());
+  const std::string header = "P4\n17 17\n";
+  ASSERT_EQ(data.substr(0, header.size()), header);
+  ASSERT_EQ(data.size(), header.size() + 17 * 3);
+  auto pixel = [&](int x, int y) {
+    return (data[header.size() + y * 3 + x / 8] >> (7 - x % 8)) & 1;
+  };
+  for (int x = 0; x < 17; x++) EXPECT_EQ(pixel(x, 0), 1);
+  for (int y = 0; y < 17; y++) EXPECT_EQ(pixel(0, y), 1);
+  //  в maze4 стена справа от клетки (1, 0) и нет стены справа от (0, 0)
+  EXPECT_EQ(pixel(4, 6), 1);
+  EXPECT_EQ(pixel(4, 2), 0);
+  //  стена снизу от клетки (0, 0) и нет стены снизу от (1, 0)
+  EXPECT_EQ(pixel(2, 4), 1);
+  EXPECT_EQ(pixel(2, 8), 0);
+}
+
+TEST(Rasterizer, PngBands) {
+  s21::Model model;
+  model.SeedGenerator(s21::GeneratorKind::kKruskal, 5);
+  model.GenerateMaze(300, 300, s21::GeneratorKind::kKruskal);
+  s21::MazeRasterizer rasterizer(3);
+  const std::string png = "tests/raster_test.png";
+  const std::string pbm = "tests/raster_test.pbm";
+  //  при стороне клетки 8 изображение делится на несколько полос
+  ASSERT_TRUE(rasterizer.Write(png, model.GetRightBorders(),
+                               model.GetBottomBorders(),
+                               s21::RasterFormat::kPng));
+  ASSERT_TRUE(rasterizer.Write(pbm, model.GetRightBorders(),
+                               model.GetBottomBorders(),
+                               s21::RasterFormat::kPbm));
+  int width = 0, height = 0;
+  auto rows = DecodePng(ReadAll(png), &width, &height);
+  std::string bits = ReadAll(pbm);
+  std::remove(png.c_str());
+  std::remove(pbm.c_str());
+  ASSERT_EQ(width, 2401);
+  ASSERT_EQ(height, 2401);
+  std::size_t offset = bits.size() - height * ((width + 7) / 8);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      int bit =
+          (bits[offset + y * ((width + 7) / 8) + x / 8] >> (7 - x % 8)) & 1;
+      ASSERT_EQ(bit, rows[y][x] != 0) << x << " " << y;
+    }
+  }
+}
+
+TEST(Rasterizer, Path) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile("mazes/maze4.txt");
+  controller.SetStartPoint({0, 0});
+  controller.SetEndPoint({3, 3});
+  const std::string filename = "tests/raster_path.png";
+  ASSERT_TRUE(controller.ExportImage(filename, 8, true));
+  int width = 0, height = 0;
+  auto rows = DecodePng(ReadAll(filename), &width, &height);
+  std::remove(filename.c_str());
+  ASSERT_EQ(width, 33);
+  //  центры клеток: начальная синяя, конечная красная, путь зеленый
+  EXPECT_EQ(rows[4][4], 3);
+  EXPECT_EQ(rows[28][28], 4);
+  std::size_t green = 0;
+  for (const auto& row : rows) green += std::count(row.begin(), row.end(), 2);
+  EXPECT_GT(green, 0u);
+
+  EXPECT_THROW(controller.ExportImage(filename, 1), std::invalid_argument);
+  EXPECT_FALSE(controller.ExportImage("tests/no_such_dir/maze.png"));
+}
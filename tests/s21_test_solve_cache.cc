@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <thread>
+
+#include "../controller/s21_controller.h"
+
+namespace {
+
+void ExpectSamePath(const std::vector<s21::Point>& a,
+                    const std::vector<s21::Point>& b) {
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < a.size(); i++) {
+    EXPECT_EQ(a[i].row, b[i].row);
+    EXPECT_EQ(a[i].col, b[i].col);
+  }
+}
+
+}  // namespace
+
+TEST(MazeHash, StreamingMatchesMatrices) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze20.txt");
+  std::uint64_t parsed = model.GetHash();
+  EXPECT_EQ(parsed, s21::MazeHash::Of(model.GetRightBorders(),
+                                      model.GetBottomBorders()));
+  model.ToggleRightWall(3, 4);
+  EXPECT_NE(model.GetHash(), parsed);
+  model.ToggleRightWall(3, 4);
+  EXPECT_EQ(model.GetHash(), parsed);
+
+  //  одинаковые биты стен при разных размерах дают разные хэши
+  s21::WallMatrix a(2, s21::WallRow(8)), b(4, s21::WallRow(4));
+  EXPECT_NE(s21::MazeHash::Of(a, a), s21::MazeHash::Of(b, b));
+  b[3][3] = 2;
+  s21::WallMatrix c(4, s21::WallRow(4));
+  c[3][3] = 1;
+  EXPECT_EQ(s21::MazeHash::Of(b, c), s21::MazeHash::Of(c, c));
+  EXPECT_NE(s21::MazeHash::Of(c, c), s21::MazeHash::Of(c, {}));
+}
+
+TEST(SolveCache, StoreAndReopen) {
+  const char* filename = "s21_test_solve_cache.bin";
+  std::remove(filename);
+  std::vector<s21::Point> long_path;
+  for (int i = 0; i < 50000; i++) long_path.push_back({i, i % 7});
+  s21::MazeStats stats;
+  stats.diameter = 42;
+  stats.diameter_end = {3, 9};
+  stats.isolated = 5;
+  {
+    s21::SolveCache cache;
+    ASSERT_TRUE(cache.Open(filename, 4));
+    std::vector<s21::Point> path;
+    EXPECT_FALSE(cache.FindPath(1, {0, 0}, {1, 1}, &path));
+    cache.StorePath(1, {0, 0}, {1, 1}, {{1, 1}, {0, 1}, {0, 0}});
+    cache.StorePath(1, {0, 0}, {2, 2}, {});
+    //  рост файла и переотображение
+    cache.StorePath(2, {0, 0}, {9, 9}, long_path);
+    cache.StoreStats(1, stats);
+    EXPECT_EQ(cache.GetMisses(), 1u);
+  }
+  s21::SolveCache cache;
+  ASSERT_TRUE(cache.Open(filename));
+  std::vector<s21::Point> path;
+  ASSERT_TRUE(cache.FindPath(1, {0, 0}, {1, 1}, &path));
+  ExpectSamePath(path, {{1, 1}, {0, 1}, {0, 0}});
+  ASSERT_TRUE(cache.FindPath(1, {0, 0}, {2, 2}, &path));
+  EXPECT_TRUE(path.empty());
+  ASSERT_TRUE(cache.FindPath(2, {0, 0}, {9, 9}, &path));
+  ExpectSamePath(path, long_path);
+  EXPECT_FALSE(cache.FindPath(3, {0, 0}, {1, 1}, &path));
+  s21::MazeStats loaded;
+  ASSERT_TRUE(cache.FindStats(1, &loaded));
+  EXPECT_EQ(loaded.diameter, 42);
+  EXPECT_EQ(loaded.diameter_end.col, 9);
+  EXPECT_EQ(loaded.isolated, 5);
+  EXPECT_EQ(cache.GetHits(), 4u);
+
+  //  таблица из 4 записей переполняется, последняя запись всегда находится
+  for (int i = 0; i < 20; i++) {
+    cache.StorePath(100 + i, {0, 0}, {0, 1}, {{0, 1}, {0, 0}});
+    EXPECT_TRUE(cache.FindPath(100 + i, {0, 0}, {0, 1}, &path));
+  }
+  cache.Close();
+  std::remove(filename);
+
+  std::FILE* file = std::fopen(filename, "w");
+  std::fputs("not a cache file at all", file);
+  std::fclose(file);
+  EXPECT_FALSE(cache.Open(filename));
+  EXPECT_FALSE(cache.IsOpen());
+  std::remove(filename);
+}
+
+TEST(SolveCache, SharedBetweenProcesses) {
+  const char* filename = "s21_test_shared_cache.bin";
+  std::remove(filename);
+  //  каждый объект открывает файл сам, как отдельный процесс
+  s21::SolveCache reader, stale;
+  ASSERT_TRUE(reader.Open(filename, 1024));
+  ASSERT_TRUE(stale.Open(filename));
+  constexpr int kWriters = 4, kPaths = 40;
+  std::vector<std::thread> writers;
+  for (int t = 0; t < kWriters; t++) {
+    writers.emplace_back([t, filename] {
+      s21::SolveCache cache;
+      ASSERT_TRUE(cache.Open(filename));
+      for (int i = 0; i < kPaths; i++) {
+        //  длинные пути растят файл далеко за отображение читателя
+        std::vector<s21::Point> path(500 * (i + 1), s21::Point(t, i));
+        cache.StorePath(t, {0, 0}, {i, i}, path);
+      }
+    });
+  }
+  for (auto& writer : writers) writer.join();
+
+  std::vector<s21::Point> path;
+  for (int t = 0; t < kWriters; t++) {
+    for (int i = 0; i < kPaths; i++) {
+      ASSERT_TRUE(reader.FindPath(t, {0, 0}, {i, i}, &path));
+      ASSERT_EQ(path.size(), 500u * (i + 1));
+      EXPECT_EQ(path.back().row, t);
+      EXPECT_EQ(path.back().col, i);
+    }
+  }
+  //  писатель со старым маленьким отображением не уменьшает файл под
+  //  большим отображением читателя, и читатель может дописывать в него
+  stale.StorePath(9, {0, 0}, {1, 1}, {{1, 1}, {0, 0}});
+  reader.StorePath(9, {0, 0}, {2, 2}, std::vector<s21::Point>(1000));
+  EXPECT_TRUE(stale.FindPath(9, {0, 0}, {2, 2}, &path));
+  EXPECT_EQ(path.size(), 1000u);
+  EXPECT_TRUE(reader.FindPath(9, {0, 0}, {1, 1}, &path));
+  std::remove(filename);
+}
+
+TEST(SolveCache, ModelAndController) {
+  const char* filename = "s21_test_model_cache.bin";
+  std::remove(filename);
+  s21::Model plain;
+  plain.ReadFromFile("mazes/maze20.txt");
+  auto expected = plain.GetPath({0, 0}, {19, 19});
+  {
+    s21::Model model;
+    s21::Controller controller(&model);
+    ASSERT_TRUE(controller.OpenSolveCache(filename));
+    controller.ReadFromFile("mazes/maze20.txt");
+    //  путь дает FixedMaze, но он тоже попадает в кэш
+    ExpectSamePath(controller.GetPath({0, 0}, {19, 19}), expected);
+    controller.GetStats();
+    EXPECT_EQ(model.GetSolveCache()->GetHits(), 0u);
+  }
+  //  другой процесс с тем же лабиринтом получает путь без поиска
+  s21::Model model;
+  s21::Controller controller(&model);
+  ASSERT_TRUE(controller.OpenSolveCache(filename));
+  controller.ReadFromFile("mazes/maze20.txt");
+  ExpectSamePath(controller.GetPath({0, 0}, {19, 19}), expected);
+  EXPECT_EQ(model.GetSolveCache()->GetHits(), 1u);
+  ExpectSamePath(model.GetPath({0, 0}, {19, 19}), expected);
+  EXPECT_EQ(model.GetMemoryUsage(s21::ModelOperation::kSolve).allocations, 0u);
+  s21::MazeStats stats = controller.GetStats();
+  EXPECT_EQ(stats.diameter, controller.GetStats().diameter);
+  EXPECT_EQ(model.GetSolveCache()->GetHits(), 4u);
+  //  правка стены меняет хэш, путь ищется заново и снова кэшируется
+  controller.ToggleBottomWall(0, 0);
+  auto changed = controller.GetPath({0, 0}, {19, 19});
+  EXPECT_EQ(model.GetSolveCache()->GetHits(), 4u);
+  ExpectSamePath(controller.GetPath({0, 0}, {19, 19}), changed);
+  EXPECT_EQ(model.GetSolveCache()->GetHits(), 5u);
+  std::remove(filename);
+}
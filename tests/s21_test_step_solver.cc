@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "../controller/s21_controller.h"
+
+TEST(StepSolver, SamePathAsModel) {
+  s21::Model model;
+  model.GenerateMaze(30, 40);
+  s21::StepSolver solver;
+  s21::Point start(2, 3), end(27, 38);
+  solver.Start(model.GetRightBorders(), model.GetBottomBorders(), start, end);
+  EXPECT_FALSE(solver.Done());
+  EXPECT_TRUE(solver.StepFor(std::chrono::seconds(10)));
+  EXPECT_TRUE(solver.Found());
+  auto expected = model.GetPath(start, end);
+  auto path = solver.GetPath();
+  ASSERT_EQ(path.size(), expected.size());
+  for (std::size_t i = 0; i < path.size(); i++) {
+    EXPECT_EQ(path[i].row, expected[i].row);
+    EXPECT_EQ(path[i].col, expected[i].col);
+  }
+  EXPECT_EQ(solver.GetDistance(end), static_cast<int>(path.size()) - 1);
+}
+
+TEST(StepSolver, Budget) {
+  s21::Model model;
+  model.GenerateMaze(20, 20);
+  s21::StepSolver solver;
+  solver.Start(model.GetRightBorders(), model.GetBottomBorders(), {0, 0},
+               {19, 19});
+  const s21::Point* data = solver.GetFrontier().begin();
+  std::size_t steps = 0;
+  while (!solver.Step(5)) {
+    steps++;
+    auto visited = solver.GetVisited();
+    auto frontier = solver.GetFrontier();
+    //  за вызов просматривается не больше бюджета, массив не переезжает
+    EXPECT_EQ(visited.size(), steps * 5);
+    EXPECT_EQ(visited.begin(), data);
+    EXPECT_EQ(visited.end(), frontier.begin());
+    EXPECT_FALSE(frontier.empty());
+    for (const s21::Point& p : frontier) EXPECT_GT(solver.GetDistance(p), 0);
+  }
+  EXPECT_TRUE(solver.Found());
+  EXPECT_GT(steps, 0u);
+  EXPECT_LE(solver.GetVisited().size(), 400u);
+  EXPECT_EQ(solver.GetPath().front().row, 19);
+  EXPECT_EQ(solver.GetPath().back().col, 0);
+}
+
+TEST(StepSolver, Unreachable) {
+  s21::WallMatrix right(2, s21::WallRow{1, 1}), bottom(2, s21::WallRow{0, 0});
+  bottom[1] = {1, 1};
+  s21::StepSolver solver;
+  solver.Start(right, bottom, {0, 0}, {1, 1});
+  EXPECT_TRUE(solver.Step(100));
+  EXPECT_FALSE(solver.Found());
+  EXPECT_EQ(solver.GetVisited().size(), 2u);
+  EXPECT_EQ(solver.GetDistance({1, 1}), -1);
+  EXPECT_TRUE(solver.GetPath().empty());
+  EXPECT_THROW(solver.Start(right, bottom, {0, 0}, {2, 0}),
+               std::invalid_argument);
+}
+
+TEST(StepSolver, ControllerResetsOnChange) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.GenerateMaze(10, 10);
+  controller.StartStepSolve({0, 0}, {9, 9});
+  controller.GetStepSolver().Step(3);
+  EXPECT_FALSE(controller.GetStepSolver().Done());
+  controller.ToggleRightWall(4, 4);
+  EXPECT_TRUE(controller.GetStepSolver().Done());
+  EXPECT_FALSE(controller.GetStepSolver().Found());
+  EXPECT_TRUE(controller.GetStepSolver().GetVisited().empty());
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <random>
+
+#include "../controller/s21_controller.h"
+
+namespace {
+
+void ExpectSameWalls(s21::Model& model, s21::TiledMaze* tiled) {
+  ASSERT_EQ(tiled->GetRows(), model.GetMazeRows());
+  ASSERT_EQ(tiled->GetCols(), model.GetMazeCols());
+  for (int i = 0; i < model.GetMazeRows(); i++) {
+    for (int j = 0; j < model.GetMazeCols(); j++) {
+      ASSERT_EQ(tiled->HasRightWall(i, j), model.GetRightBorders()[i][j] != 0);
+      ASSERT_EQ(tiled->HasBottomWall(i, j),
+                model.GetBottomBorders()[i][j] != 0);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(TiledMaze, WriteAndConvert) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze10.txt");
+  const std::string written = "tests/tiled_written.tiles";
+  const std::string converted = "tests/tiled_converted.tiles";
+  ASSERT_TRUE(s21::TiledMaze::Write(written, model.GetRightBorders(),
+                                    model.GetBottomBorders(), 3));
+  ASSERT_TRUE(s21::TiledMaze::Convert("mazes/maze10.txt", converted, 3));
+  s21::TiledMaze tiled;
+  ASSERT_TRUE(tiled.Open(written, 2));
+  EXPECT_EQ(tiled.GetTileSize(), 3);
+  ExpectSameWalls(model, &tiled);
+  EXPECT_GT(tiled.GetLoads(), 16u);
+  ASSERT_TRUE(tiled.Open(converted));
+  ExpectSameWalls(model, &tiled);
+  //  при достаточном кэше каждая из 16 плиток загружается один раз
+  EXPECT_EQ(tiled.GetLoads(), 16u);
+  std::remove(written.c_str());
+  std::remove(converted.c_str());
+
+  EXPECT_FALSE(tiled.Open("mazes/maze10.txt"));
+  EXPECT_FALSE(tiled.IsOpen());
+  EXPECT_FALSE(s21::TiledMaze::Convert("mazes/nonexistent.txt", converted));
+}
+
+TEST(TiledSolver, SameAsGetPath) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.GenerateMaze(90, 130);
+  const std::string filename = "tests/tiled_solver.tiles";
+  ASSERT_TRUE(controller.SaveTiled(filename, 16));
+  s21::TiledMaze tiled;
+  ASSERT_TRUE(tiled.Open(filename, 3));
+  s21::TiledSolver solver;
+  std::mt19937 gen(4);
+  for (int i = 0; i < 20; i++) {
+    s21::Point start(gen() % 90, gen() % 130), end(gen() % 90, gen() % 130);
+    auto path = solver.Solve(&tiled, start, end);
+    auto expected = model.GetPath(start, end);
+    ASSERT_EQ(path.size(), expected.size());
+    for (std::size_t j = 0; j < path.size(); j++) {
+      EXPECT_EQ(path[j].row, expected[j].row);
+      EXPECT_EQ(path[j].col, expected[j].col);
+    }
+    EXPECT_FALSE(solver.IsSpilled());
+  }
+  EXPECT_GT(solver.GetTileLoads(), 0u);
+
+  auto path = controller.SolveTiled(filename, {0, 0}, {89, 129});
+  EXPECT_EQ(path.size(), model.GetPath({0, 0}, {89, 129}).size());
+  EXPECT_GT(controller.GetTiledSolver().GetTileLoads(), 0u);
+  std::remove(filename.c_str());
+}
+
+TEST(TiledSolver, SpillAndUnreachable) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4disconnected.txt");
+  const std::string filename = "tests/tiled_spill.tiles";
+  ASSERT_TRUE(s21::TiledMaze::Write(filename, model.GetRightBorders(),
+                                    model.GetBottomBorders(), 2));
+  s21::TiledMaze tiled;
+  ASSERT_TRUE(tiled.Open(filename, 1));
+  s21::TiledSolver solver;
+  solver.SetSpill("tests", 0);
+  EXPECT_TRUE(solver.Solve(&tiled, {0, 0}, {2, 2}).empty());
+  EXPECT_TRUE(solver.IsSpilled());
+  auto path = solver.Solve(&tiled, {0, 0}, {2, 0});
+  EXPECT_EQ(path.size(), model.GetPath({0, 0}, {2, 0}).size());
+  EXPECT_EQ(solver.Solve(&tiled, {1, 1}, {1, 1}).size(), 1u);
+  EXPECT_THROW(solver.Solve(&tiled, {0, 0}, {4, 0}), std::invalid_argument);
+  std::remove(filename.c_str());
+}
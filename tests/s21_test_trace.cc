@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include "../model/s21_trace.h"
+
+namespace {
+
+//  интервалы с заданным именем; трассировщик общий для всех тестов, поэтому
+//  каждый тест использует свои имена
+std::vector<s21::TraceEvent> EventsNamed(const char* name) {
+  std::vector<s21::TraceEvent> result;
+  for (const auto& event : s21::Tracer::Instance().Collect()) {
+    if (std::strcmp(event.name, name) == 0) result.push_back(event);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(Trace, NestedSpans) {
+  {
+    s21::TraceSpan outer("test.nested.outer");
+    s21::TraceSpan inner("test.nested.inner");
+  }
+  auto outer = EventsNamed("test.nested.outer");
+  auto inner = EventsNamed("test.nested.inner");
+  ASSERT_EQ(outer.size(), 1u);
+  ASSERT_EQ(inner.size(), 1u);
+  EXPECT_EQ(outer[0].thread, inner[0].thread);
+  EXPECT_LE(outer[0].start, inner[0].start);
+  EXPECT_GE(outer[0].start + outer[0].duration,
+            inner[0].start + inner[0].duration);
+}
+
+TEST(Trace, ThreadsWriteOwnBuffers) {
+  { s21::TraceSpan span("test.threads"); }
+  std::thread worker([] { s21::TraceSpan span("test.threads"); });
+  worker.join();
+  auto events = EventsNamed("test.threads");
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_NE(events[0].thread, events[1].thread);
+}
+
+TEST(Trace, RingKeepsNewest) {
+  auto buffer = std::make_unique<s21::TraceBuffer>(7);
+  std::uint64_t total = s21::TraceBuffer::kCapacity + 100;
+  for (std::uint64_t i = 0; i < total; i++) buffer->Push("test.ring", i, 1);
+  std::vector<s21::TraceEvent> events;
+  buffer->Collect(&events);
+  EXPECT_EQ(buffer->GetPushed(), total);
+  ASSERT_EQ(events.size(), s21::TraceBuffer::kCapacity);
+  EXPECT_EQ(events.front().start, 100u);
+  EXPECT_EQ(events.back().start, total - 1);
+  EXPECT_EQ(events.back().thread, 7);
+}
+
+TEST(Trace, DumpChromeJson) {
+  { s21::TraceSpan span("test.dump \"quoted\""); }
+  ASSERT_TRUE(s21::Tracer::Instance().Dump("trace_test.json"));
+  std::ifstream file("trace_test.json");
+  std::stringstream text;
+  text << file.rdbuf();
+  std::string json = text.str();
+  EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+  EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+  EXPECT_NE(json.find("\"name\":\"test.dump \\\"quoted\\\"\",\"cat\":\"maze\","
+                      "\"ph\":\"X\""),
+            std::string::npos);
+  EXPECT_NE(json.find("\"thread_name\""), std::string::npos);
+  EXPECT_EQ(json.find(",]"), std::string::npos);
+  std::remove("trace_test.json");
+}
+
+#ifndef S21_WITH_TRACE
+TEST(Trace, MacrosDisabled) {
+  { S21_TRACE_SCOPE("test.disabled"); }
+  EXPECT_TRUE(EventsNamed("test.disabled").empty());
+}
+#endif
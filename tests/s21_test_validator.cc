@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "../controller/s21_controller.h"
+#include "../model/s21_model.h"
+
+using Kind = s21::MazeValidation::Kind;
+
+TEST(Validator, Perfect) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4.txt");
+  s21::MazeValidation result = model.Validate();
+  EXPECT_EQ(result.kind, Kind::kPerfect);
+  EXPECT_FALSE(result.has_loops);
+  EXPECT_FALSE(result.open_right_edge);
+  EXPECT_FALSE(result.open_bottom_edge);
+  EXPECT_EQ(result.components, 1);
+  EXPECT_EQ(result.component_sizes[0], 16);
+}
+
+TEST(Validator, Generated) {
+  s21::Model model;
+  model.GenerateMaze(30, 20);
+  s21::MazeValidation result = model.Validate();
+  EXPECT_EQ(result.kind, Kind::kPerfect);
+  EXPECT_FALSE(result.open_right_edge);
+}
+
+TEST(Validator, Disconnected) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4disconnected.txt");
+  s21::MazeValidation result = model.Validate();
+  EXPECT_EQ(result.kind, Kind::kDisconnected);
+  EXPECT_EQ(result.components, 2);
+  EXPECT_EQ(result.component_sizes[0] + result.component_sizes[1], 16);
+  EXPECT_NE(result.component[2 * 4 + 2], result.component[0]);
+  EXPECT_TRUE(model.GetPath({0, 0}, {2, 2}).empty());
+  EXPECT_FALSE(model.GetPath({0, 0}, {2, 0}).empty());
+}
+
+TEST(Validator, Looped) {
+  s21::WallMatrix right = {{0, 1}, {0, 1}};
+  s21::WallMatrix bottom = {{0, 0}, {1, 1}};
+  s21::MazeValidator validator;
+  s21::MazeValidation result = validator.Validate(right, bottom);
+  EXPECT_EQ(result.kind, Kind::kLooped);
+  EXPECT_TRUE(result.has_loops);
+  EXPECT_EQ(result.components, 1);
+}
+
+TEST(Validator, Repair) {
+  s21::Model model;
+  model.ReadFromFile("mazes/maze4disconnected.txt");
+  EXPECT_GT(model.RepairMaze(), 0);
+  EXPECT_EQ(model.Validate().kind, Kind::kPerfect);
+  EXPECT_FALSE(model.GetPath({0, 0}, {2, 2}).empty());
+
+  s21::WallMatrix right(5, s21::WallRow(7, 0));
+  s21::WallMatrix bottom(5, s21::WallRow(7, 0));
+  s21::MazeValidator validator;
+  validator.Repair(&right, &bottom);
+  s21::MazeValidation result = validator.Validate(right, bottom);
+  EXPECT_EQ(result.kind, Kind::kPerfect);
+  EXPECT_FALSE(result.open_right_edge);
+  EXPECT_FALSE(result.open_bottom_edge);
+}
+
+TEST(Validator, ControllerRepair) {
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile("mazes/maze4disconnected.txt");
+  EXPECT_TRUE(controller.GetPath({0, 0}, {2, 2}).empty());
+  controller.RepairMaze();
+  EXPECT_EQ(controller.Validate().kind, Kind::kPerfect);
+  EXPECT_FALSE(controller.GetPath({0, 0}, {2, 2}).empty());
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+
+#include "../controller/s21_controller.h"
+
+namespace {
+
+//  стоимость пути обычной кучей для сравнения
+std::int64_t HeapCost(const s21::WallMatrix& right,
+                      const s21::WallMatrix& bottom,
+                      const s21::CostMatrix& costs, s21::Point start,
+                      s21::Point end) {
+  int rows = right.size(), cols = right[0].size();
+  std::vector<std::int64_t> dist(rows * cols, -1);
+  using Entry = std::pair<std::int64_t, int>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+  dist[start.row * cols + start.col] = 0;
+  heap.push({0, start.row * cols + start.col});
+  while (!heap.empty()) {
+    auto [d, cell] = heap.top();
+    heap.pop();
+    if (d != dist[cell]) continue;
+    int row = cell / cols, col = cell % cols;
+    auto relax = [&](bool open, int next_row, int next_col) {
+      if (!open) return;
+      int next = next_row * cols + next_col;
+      std::int64_t nd = d + costs[next_row][next_col];
+      if (dist[next] >= 0 && dist[next] <= nd) return;
+      dist[next] = nd;
+      heap.push({nd, next});
+    };
+    relax(col < cols - 1 && !right[row][col], row, col + 1);
+    relax(col > 0 && !right[row][col - 1], row, col - 1);
+    relax(row > 0 && !bottom[row - 1][col], row - 1, col);
+    relax(row < rows - 1 && !bottom[row][col], row + 1, col);
+  }
+  return dist[end.row * cols + end.col];
+}
+
+//  проверка, что путь проходим и его стоимость равна cost
+void CheckPath(const s21::WallMatrix& right, const s21::WallMatrix& bottom,
+               const s21::CostMatrix& costs, const s21::WeightedPath& result) {
+  std::int64_t cost = 0;
+  for (std::size_t i = 1; i < result.path.size(); i++) {
+    s21::Point a = result.path[i - 1], b = result.path[i];
+    if (a.row == b.row) {
+      ASSERT_EQ(std::abs(a.col - b.col), 1);
+      EXPECT_FALSE(right[a.row][std::min(a.col, b.col)]);
+    } else {
+      ASSERT_EQ(std::abs(a.row - b.row), 1);
+      ASSERT_EQ(a.col, b.col);
+      EXPECT_FALSE(bottom[std::min(a.row, b.row)][a.col]);
+    }
+    cost += costs[a.row][a.col];
+  }
+  EXPECT_EQ(cost, result.cost);
+}
+
+}  // namespace
+
+TEST(WeightedSolver, UnitCostsMatchModel) {
+  s21::Model model;
+  model.GenerateMaze(40, 30);
+  s21::WeightedSolver solver;
+  auto result = solver.Solve(model.GetRightBorders(), model.GetBottomBorders(),
+                             nullptr, {1, 2}, {38, 29});
+  auto expected = model.GetPath({1, 2}, {38, 29});
+  ASSERT_EQ(result.path.size(), expected.size());
+  EXPECT_EQ(result.cost, static_cast<std::int64_t>(expected.size()) - 1);
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(result.path[i].row, expected[i].row);
+    EXPECT_EQ(result.path[i].col, expected[i].col);
+  }
+}
+
+TEST(WeightedSolver, AvoidsSlowZone) {
+  s21::WallMatrix right(5, s21::WallRow(5)), bottom(5, s21::WallRow(5));
+  s21::CostMatrix costs(5, s21::WallRow(5, 1));
+  //  медленная полоса поперек прямого пути с одним быстрым проходом
+  for (int i = 0; i < 5; i++) costs[i][2] = 20;
+  costs[4][2] = 2;
+  s21::WeightedSolver solver;
+  auto result = solver.Solve(right, bottom, &costs, {0, 0}, {0, 4});
+  CheckPath(right, bottom, costs, result);
+  EXPECT_EQ(result.cost, 13);
+  bool crossed_fast = false;
+  for (const s21::Point& p : result.path) {
+    crossed_fast |= p.row == 4 && p.col == 2;
+  }
+  EXPECT_TRUE(crossed_fast);
+}
+
+TEST(WeightedSolver, RandomCostsMatchHeap) {
+  s21::Model model;
+  model.GenerateMaze(30, 30);
+  //  лишние проходы дают несколько путей разной стоимости
+  std::mt19937 random(5);
+  s21::WallMatrix right = model.GetRightBorders();
+  s21::WallMatrix bottom = model.GetBottomBorders();
+  for (int i = 0; i < 200; i++) {
+    right[random() % 30][random() % 29] = 0;
+    bottom[random() % 29][random() % 30] = 0;
+  }
+  s21::WeightedSolver solver;
+  for (int max_cost : {1, 3, 40, s21::WeightedSolver::kMaxCost}) {
+    s21::CostMatrix costs(30, s21::WallRow(30));
+    for (auto& row : costs) {
+      for (int& cost : row) cost = 1 + random() % max_cost;
+    }
+    for (int query = 0; query < 5; query++) {
+      s21::Point start(random() % 30, random() % 30);
+      s21::Point end(random() % 30, random() % 30);
+      auto result = solver.Solve(right, bottom, &costs, start, end);
+      CheckPath(right, bottom, costs, result);
+      EXPECT_EQ(result.cost, HeapCost(right, bottom, costs, start, end));
+      EXPECT_EQ(result.path.front().row, end.row);
+      EXPECT_EQ(result.path.back().col, start.col);
+    }
+  }
+  right.assign(2, s21::WallRow{1, 1});
+  bottom.assign(2, s21::WallRow{1, 1});
+  EXPECT_EQ(solver.Solve(right, bottom, nullptr, {0, 0}, {1, 1}).cost, -1);
+  EXPECT_THROW(solver.Solve(right, bottom, nullptr, {0, 0}, {2, 1}),
+               std::invalid_argument);
+}
+
+TEST(WeightedSolver, CostPlaneInFile) {
+  const char* filename = "s21_test_weighted.txt";
+  std::FILE* file = std::fopen(filename, "w");
+  std::fputs("2 3\n0 0 1\n0 0 1\n\n0 1 0\n1 1 1\n\n1 9 1\n1 1 1\n", file);
+  std::fclose(file);
+  s21::Model model;
+  s21::Controller controller(&model);
+  controller.ReadFromFile(filename);
+  ASSERT_TRUE(controller.HasCosts());
+  EXPECT_EQ(model.GetCosts()[0][1], 9);
+  auto result = controller.GetWeightedPath({0, 0}, {0, 2});
+  EXPECT_EQ(result.cost, 4);
+  EXPECT_EQ(result.path.size(), 5u);
+
+  ASSERT_TRUE(controller.SaveToFile(filename));
+  s21::Model copy;
+  copy.ReadFromFile(filename);
+  EXPECT_EQ(copy.GetCosts(), model.GetCosts());
+  std::remove(filename);
+
+  EXPECT_THROW(controller.SetCosts(s21::CostMatrix(2, s21::WallRow(2, 1))),
+               std::invalid_argument);
+  EXPECT_THROW(controller.SetCosts(s21::CostMatrix(2, s21::WallRow(3, 0))),
+               std::invalid_argument);
+  controller.SetCosts({});
+  EXPECT_EQ(controller.GetWeightedPath({0, 0}, {0, 2}).cost, 2);
+  controller.SetCosts(s21::CostMatrix(2, s21::WallRow(3, 5)));
+  EXPECT_EQ(controller.GetWeightedPath({0, 0}, {0, 2}).cost, 10);
+  controller.GenerateMaze(4, 4);
+  EXPECT_FALSE(controller.HasCosts());
+}
@@ -1,12 +1,23 @@
 #include "s21_view.h"
 
+#include "../model/s21_trace.h"
 #include "ui_view.h"
 
 namespace s21 {
 
+namespace {
+
+//  период кадра анимации и время поиска за кадр, остальное время кадра
+//  остается на отрисовку и события
+constexpr int kFramePeriodMs = 16;
+constexpr std::chrono::microseconds kFrameBudget{4000};
+
+}  // namespace
+
 View::View(s21::Controller *controller)
     : ui_(new Ui::MainWindow), controller_(controller) {
   ui_->setupUi(this);
+  connect(&wave_timer_, &QTimer::timeout, this, &View::AnimateWave);
   Initialize();
 }
 
@@ -19,21 +30,27 @@ void View::Initialize() {
   cell_height_ = maze_size_ / maze_rows_;
   is_end_set_ = false;
   is_start_set_ = false;
+  wave_timer_.stop();
+  path_ = CompactPath();
   update();
 }
 
 void View::paintEvent(QPaintEvent *event) {
+  S21_TRACE_SCOPE("View::paintEvent");
   Q_UNUSED(event);
   QPainter painter(this);
   painter.setPen(QPen(Qt::black, 2));
   painter.drawRect(offset_, offset_, maze_size_, maze_size_);
   if (maze_cols_ == 0 || maze_rows_ == 0) return;
+  DrawWave(&painter);
+  painter.setPen(QPen(Qt::black, 2));
   DrawMaze(&painter);
   DrawStartEndPoints(&painter);
   DrawPath(&painter);
 }
 
 void View::DrawMaze(QPainter *painter) {
+  S21_TRACE_SCOPE("View::DrawMaze");
   const auto &rightBorders = controller_->GetRightBorders();
   const auto &bottomBorders = controller_->GetBottomBorders();
 
@@ -57,23 +74,58 @@ void View::DrawMaze(QPainter *painter) {
 }
 
 void View::mousePressEvent(QMouseEvent *event) {
+  S21_TRACE_SCOPE("View::mousePressEvent");
+  //  у пустого лабиринта нет клеток, и ширина клетки бесконечна
+  if (maze_rows_ == 0 || maze_cols_ == 0) return;
   int x = event->pos().x();
   int y = event->pos().y();
+  //  правая и нижняя рамки уже за последней клеткой
+  if (x < offset_ || x >= offset_ + maze_size_ || y < offset_ ||
+      y >= offset_ + maze_size_) {
+    return;
+  }
 
-  int cellX = (x - offset_) / cell_width_ + 1;
-  int cellY = (y - offset_) / cell_height_ + 1;
-
-  if (x >= offset_ && x <= offset_ + maze_size_ && y >= offset_ &&
-      y <= offset_ + maze_size_) {
-    Point clickedPoint(cellY - 1, cellX - 1);
-    if (event->button() == Qt::LeftButton) {
-      controller_->SetStartPoint(clickedPoint);
-      is_start_set_ = true;
-    } else if (event->button() == Qt::RightButton) {
-      controller_->SetEndPoint(clickedPoint);
-      is_end_set_ = true;
-    }
-    update();  // Обновляем отрисовку
+  int col = std::min(static_cast<int>((x - offset_) / cell_width_),
+                     maze_cols_ - 1);
+  int row = std::min(static_cast<int>((y - offset_) / cell_height_),
+                     maze_rows_ - 1);
+  Point clickedPoint(row, col);
+  if (event->modifiers() & Qt::ControlModifier) {
+    ToggleNearestWall(x, y);  // Ctrl + клик редактирует стены
+    //  путь после правки берется из починенного поля расстояний модели,
+    //  без анимации нового поиска
+    wave_timer_.stop();
+    UpdatePath();
+  } else if (event->button() == Qt::LeftButton) {
+    controller_->SetStartPoint(clickedPoint);
+    is_start_set_ = true;
+    StartWave();
+  } else if (event->button() == Qt::RightButton) {
+    controller_->SetEndPoint(clickedPoint);
+    is_end_set_ = true;
+    StartWave();
+  }
+  update();  // Обновляем отрисовку
+}
+
+void View::ToggleNearestWall(int x, int y) {
+  if (maze_rows_ == 0 || maze_cols_ == 0) return;
+  double cellX = (x - offset_) / cell_width_;
+  double cellY = (y - offset_) / cell_height_;
+  int col = std::min(static_cast<int>(cellX), maze_cols_ - 1);
+  int row = std::min(static_cast<int>(cellY), maze_rows_ - 1);
+  double left = cellX - col, top = cellY - row;
+  double nearest = std::min(std::min(left, 1 - left), std::min(top, 1 - top));
+
+  //  внешние стены лабиринта не редактируются
+  if (nearest == 1 - left && col < maze_cols_ - 1) {
+    controller_->ToggleRightWall(row, col);
+  } else if (nearest == left && col > 0) {
+    controller_->ToggleRightWall(row, col - 1);
+  } else if (nearest == 1 - top && row < maze_rows_ - 1) {
+    controller_->ToggleBottomWall(row, col);
+  } else if (nearest == top && row > 0) {
+    controller_->ToggleBottomWall(row - 1, col);
   }
 }
 
@@ -84,6 +136,7 @@ void View::on_clear_button_clicked() {
 }
 
 void View::on_generate_button_clicked() {
+  S21_TRACE_SCOPE("View::GenerateClicked");
   ui_->filename_label->setText("No file");
   controller_->ClearData();
   controller_->GenerateMaze(ui_->rows_spinbox->value(),
@@ -92,9 +145,11 @@ void View::on_generate_button_clicked() {
 }
 
 void View::on_open_button_clicked() {
+  S21_TRACE_SCOPE("View::OpenClicked");
   QString fileName_open;
   fileName_open = QFileDialog::getOpenFileName(
-      this, "Открыть файл с лабиринтом", "~/", "*.txt", nullptr,
+      this, "Открыть файл с лабиринтом", "~/",
+      "*.txt *.txt.gz *.txt.zst", nullptr,
       QFileDialog::DontUseNativeDialog);
   if (fileName_open.isNull()) {
     return;
@@ -134,61 +189,87 @@ void View::DrawStartEndPoints(QPainter *painter) {
   }
 }
 
+void View::StartWave() {
+  //  после смены точек старый путь больше не верен
+  path_ = CompactPath();
+  if (!is_start_set_ || !is_end_set_) return;
+  try {
+    controller_->StartStepSolve(controller_->GetStartPoint(),
+                                controller_->GetEndPoint());
+  } catch (const std::invalid_argument &) {
+    //  Qt не перехватывает исключения из обработчиков событий
+    return;
+  }
+  wave_timer_.start(kFramePeriodMs);
+}
+
+void View::AnimateWave() {
+  S21_TRACE_SCOPE("View::AnimateWave");
+  if (controller_->GetStepSolver().StepFor(kFrameBudget)) {
+    wave_timer_.stop();
+    UpdatePath();
+  }
+  update();
+}
+
+void View::UpdatePath() {
+  S21_TRACE_SCOPE("View::UpdatePath");
+  path_ = CompactPath();
+  if (!is_start_set_ || !is_end_set_) return;
+  //  путь дает контроллер: кэш путей, FixedMaze, индекс или поле
+  //  расстояний модели, а StepSolver нужен только для анимации волны
+  path_ = controller_->GetCompactPath(controller_->GetStartPoint(),
+                                      controller_->GetEndPoint());
+}
+
+void View::DrawWave(QPainter *painter) {
+  S21_TRACE_SCOPE("View::DrawWave");
+  const StepSolver &solver = controller_->GetStepSolver();
+  if (solver.Done()) return;
+  painter->setPen(Qt::NoPen);
+  painter->setBrush(QBrush(QColor(200, 230, 200)));
+  for (const Point &cell : solver.GetVisited()) {
+    painter->drawRect(QRectF(offset_ + cell.col * cell_width_ + 1,
+                             offset_ + cell.row * cell_height_ + 1,
+                             cell_width_ - 2, cell_height_ - 2));
+  }
+  painter->setBrush(QBrush(QColor(90, 170, 90)));
+  for (const Point &cell : solver.GetFrontier()) {
+    painter->drawRect(QRectF(offset_ + cell.col * cell_width_ + 1,
+                             offset_ + cell.row * cell_height_ + 1,
+                             cell_width_ - 2, cell_height_ - 2));
+  }
+}
+
 void View::DrawPath(QPainter *painter) {
-  if (is_start_set_ && is_end_set_) {
-    const auto &path = controller_->GetPath(controller_->GetStartPoint(),
-                                            controller_->GetEndPoint());
-    painter->setPen(QPen(Qt::green, 4));
-    if (!path.empty()) {
-      for (size_t i = 0; i < path.size() - 1; i++) {
-        double centerX = offset_ + path[i].col * cell_width_ + cell_width_ / 2;
-        double centerY =
-            offset_ + path[i].row * cell_height_ + cell_height_ / 2;
-        double nextCenterX =
-            offset_ + path[i + 1].col * cell_width_ + cell_width_ / 2;
-        double nextCenterY =
-            offset_ + path[i + 1].row * cell_height_ + cell_height_ / 2;
-        painter->drawLine(centerX, centerY, nextCenterX, nextCenterY);
-      }
-    }
+  S21_TRACE_SCOPE("View::DrawPath");
+  //  пока поиск не закончен, вместо пути рисуется волна. Путь запоминается
+  //  при завершении поиска и правке стен, перерисовка его не ищет
+  if (!controller_->GetStepSolver().Done()) return;
+  painter->setPen(QPen(Qt::green, 4));
+  //  каждый прямой участок пути рисуется одной линией
+  for (const auto &run : path_.GetRuns()) {
+    double centerX = offset_ + run.from.col * cell_width_ + cell_width_ / 2;
+    double centerY = offset_ + run.from.row * cell_height_ + cell_height_ / 2;
+    double nextCenterX = offset_ + run.to.col * cell_width_ + cell_width_ / 2;
+    double nextCenterY = offset_ + run.to.row * cell_height_ + cell_height_ / 2;
+    painter->drawLine(centerX, centerY, nextCenterX, nextCenterY);
   }
 }
 
 void View::on_savetofile_button_clicked() {
+  S21_TRACE_SCOPE("View::SaveClicked");
   QString fileName_save;
   fileName_save = QFileDialog::getSaveFileName(
-      this, "Выберите файл для сохранения", "~/", "*.txt");
+      this, "Выберите файл для сохранения", "~/", "*.txt *.txt.gz *.txt.zst");
   if (!fileName_save.isEmpty()) {
     QFileInfo fileInfo(fileName_save);
-    // Проверяем, указано ли расширение .txt
+    // Проверяем, указано ли расширение .txt, .gz или .zst
     if (fileInfo.suffix().isEmpty()) {
       fileName_save += ".txt";
     }
-    QFile file(fileName_save);
-
-    if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-      QTextStream out(&file);
-      //  сохраняем размеры лабиринта
-      out << maze_rows_ << " " << maze_cols_ << "\n";
-
-      const auto &rightBorders = controller_->GetRightBorders();
-      const auto &bottomBorders = controller_->GetBottomBorders();
-
-      for (int i = 0; i < maze_rows_; i++) {
-        for (int j = 0; j < maze_cols_; j++) {
-          out << rightBorders[i][j] << " ";
-        }
-        out << "\n";
-      }
-
-      for (int i = 0; i < maze_rows_; i++) {
-        for (int j = 0; j < maze_cols_; j++) {
-          out << bottomBorders[i][j] << " ";
-        }
-        out << "\n";
-      }
-      // Закрываем файл
-      file.close();
+    // Сжатие выбирается по расширению файла
+    if (controller_->SaveToFile(fileName_save.toStdString())) {
       QMessageBox::information(this, "Успех",
                                "Данные успешно сохранены в файл.");
     } else {
@@ -9,6 +9,7 @@
 #include <QMessageBox>
 #include <QMouseEvent>
 #include <QPainter>
+#include <QTimer>
 
 #include "../controller/s21_controller.h"
 
@@ -60,13 +61,36 @@ class View : public QMainWindow {
    * @param painter - холст для отрисовки
    */
   void DrawStartEndPoints(QPainter *painter);
+  /**
+   * Метод переключения ближайшей к точке клика стены
+   * @param x - координата клика по горизонтали
+   * @param y - координата клика по вертикали
+   */
+  void ToggleNearestWall(int x, int y);
   /**
    * Метод отрисовки пути
    * @param painter - холст для отрисовки
    */
   void DrawPath(QPainter *painter);
+  /**
+   * Метод отрисовки просмотренных клеток и фронта волны, пока идет поиск
+   * @param painter - холст для отрисовки
+   */
+  void DrawWave(QPainter *painter);
+  /**
+   * Метод начала анимации поиска пути, если заданы обе точки
+   */
+  void StartWave();
+  /**
+   * Метод получения пути между заданными точками из контроллера
+   */
+  void UpdatePath();
 
  private slots:
+  /**
+   * Метод продолжения поиска пути на один кадр анимации
+   */
+  void AnimateWave();
   void on_clear_button_clicked();
   void on_generate_button_clicked();
   void on_open_button_clicked();
@@ -82,6 +106,9 @@ class View : public QMainWindow {
   int maze_rows_, maze_cols_;
   bool is_start_set_ = false;
   bool is_end_set_ = false;
+  QTimer wave_timer_;
+  //  путь между заданными точками, рисуется без повторного поиска
+  CompactPath path_;
 };
 }  // namespace s21
 #endif  // SRC_VIEW_S21_VIEW_H_